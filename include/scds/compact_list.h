@@ -0,0 +1,80 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_COMPACT_LIST_H
+#define SCDS_COMPACT_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Macros
+ */
+#define COMPACT_LIST_NIL UINT32_MAX
+
+/**
+ * Represents a node in a compact list, linked to its neighbours by index.
+ */
+typedef struct compact_node {
+    void *data;
+    uint32_t next;
+    uint32_t prev;
+} compact_node_t;
+
+/**
+ * Represents a doubly linked list whose nodes live in a single growable array.
+ */
+typedef struct compact_list {
+    compact_node_t *nodes;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t free_list;
+    uint32_t used;
+    uint32_t capacity;
+    size_t size;
+} compact_list_t;
+
+/**
+ * Functions
+ */
+compact_list_t* compact_list_new();
+int compact_list_free(compact_list_t *list);
+int compact_list_init(compact_list_t *list);
+int compact_list_destroy(compact_list_t *list);
+int compact_list_reserve(compact_list_t *list, size_t capacity);
+
+int compact_list_insert(compact_list_t *list, void *data);
+int compact_list_remove(compact_list_t *list, void *data);
+bool compact_list_contains(compact_list_t *list, void *data);
+int compact_list_remove_if(compact_list_t *list, void *data, bool (*predicate)(void *, void *));
+int compact_list_steal_if(compact_list_t *list, compact_list_t *dest, void *data, bool (*predicate)(void *, void *));
+int compact_list_steal(compact_list_t *source, compact_list_t *dest, size_t index);
+int compact_list_sort(compact_list_t *list, compare_func_t compare);
+int compact_list_sort_r(compact_list_t *list, compare_r_func_t compare, void *ctx);
+int compact_list_clear(compact_list_t *list);
+
+#endif
@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_CONCURRENT_LIST_H
+#define SCDS_CONCURRENT_LIST_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Macros
+ */
+#define CONCURRENT_LIST_CACHE_LINE 64
+
+/**
+ * Typedefs
+ */
+typedef struct concurrent_node concurrent_node_t;
+typedef struct concurrent_reader concurrent_reader_t;
+
+/**
+ * Structs
+ */
+
+/**
+ * Represents a node in a concurrent list. Readers only ever follow next, a removed node
+ * keeps it until the node is reclaimed.
+ */
+typedef struct concurrent_node {
+    void *data;
+    concurrent_node_t *next;
+    concurrent_node_t *retired;
+    uint64_t retired_epoch;
+} concurrent_node_t;
+
+/**
+ * Represents a reader thread registered with a concurrent list, padded to a cache line so
+ * readers don't share one. epoch is 0 outside of a read section.
+ */
+typedef struct concurrent_reader {
+    uint64_t epoch;
+    concurrent_reader_t *next;
+    char padding[CONCURRENT_LIST_CACHE_LINE - sizeof(uint64_t) - sizeof(concurrent_reader_t *)];
+} concurrent_reader_t;
+
+/**
+ * Represents a singly linked list that readers traverse without locking while writers
+ * serialise on a mutex. Removed nodes are reclaimed once no read section that could see
+ * them remains.
+ */
+typedef struct concurrent_list {
+    concurrent_node_t *head;
+    uint64_t epoch;
+    char head_padding[CONCURRENT_LIST_CACHE_LINE - sizeof(concurrent_node_t *) - sizeof(uint64_t)];
+    pthread_mutex_t lock;
+    concurrent_node_t *tail;
+    size_t size;
+    concurrent_reader_t *readers;
+    concurrent_node_t *retired_head;
+    concurrent_node_t *retired_tail;
+} concurrent_list_t;
+
+/**
+ * Functions
+ */
+int concurrent_list_init(concurrent_list_t *list);
+int concurrent_list_destroy(concurrent_list_t *list);
+
+int concurrent_list_register(concurrent_list_t *list, concurrent_reader_t *reader);
+int concurrent_list_unregister(concurrent_list_t *list, concurrent_reader_t *reader);
+int concurrent_list_read_lock(concurrent_list_t *list, concurrent_reader_t *reader);
+int concurrent_list_read_unlock(concurrent_reader_t *reader);
+concurrent_node_t* concurrent_list_first(concurrent_list_t *list);
+concurrent_node_t* concurrent_list_next(concurrent_node_t *node);
+bool concurrent_list_contains(concurrent_list_t *list, concurrent_reader_t *reader, void *data);
+int concurrent_list_for_each(concurrent_list_t *list, concurrent_reader_t *reader, void *ctx, bool (*visit)(void *, void *));
+size_t concurrent_list_size(concurrent_list_t *list);
+
+int concurrent_list_insert(concurrent_list_t *list, void *data);
+int concurrent_list_remove(concurrent_list_t *list, void *data);
+int concurrent_list_remove_if(concurrent_list_t *list, void *data, bool (*predicate)(void *, void *));
+int concurrent_list_steal_if(concurrent_list_t *list, concurrent_list_t *dest, void *data, bool (*predicate)(void *, void *));
+int concurrent_list_clear(concurrent_list_t *list);
+int concurrent_list_reclaim(concurrent_list_t *list);
+
+#endif
@@ -0,0 +1,75 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_ILIST_H
+#define SCDS_ILIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Macros
+ */
+#define ilist_entry(link, type, member) ((type *) ((char *) (link) - offsetof(type, member)))
+
+/**
+ * Typedefs
+ */
+typedef struct ilist_link ilist_link_t;
+
+/**
+ * Structs
+ */
+typedef bool (*ilist_predicate_t)(ilist_link_t *, void *);
+typedef void (*ilist_dispose_t)(ilist_link_t *);
+
+/**
+ * Represents a link embedded in an object stored in an intrusive list.
+ */
+typedef struct ilist_link {
+    ilist_link_t *next;
+    ilist_link_t *prev;
+} ilist_link_t;
+
+/**
+ * Represents an intrusive doubly linked list.
+ */
+typedef struct ilist {
+    ilist_link_t *head;
+    ilist_link_t *tail;
+    size_t size;
+} ilist_t;
+
+/**
+ * Functions
+ */
+int ilist_init(ilist_t *list);
+
+int ilist_insert(ilist_t *list, ilist_link_t *link);
+int ilist_remove(ilist_t *list, ilist_link_t *link);
+int ilist_remove_if(ilist_t *list, void *data, ilist_predicate_t predicate, ilist_dispose_t dispose);
+int ilist_steal_if(ilist_t *list, ilist_t *dest, void *data, ilist_predicate_t predicate);
+int ilist_clear(ilist_t *list, ilist_dispose_t dispose);
+
+#endif
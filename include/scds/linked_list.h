@@ -26,16 +26,25 @@ SOFTWARE.
 #define SCDS_LL_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /**
  * Typedefs
  */
 typedef struct node node_t;
+typedef struct node_pool node_pool_t;
+typedef struct node_index node_index_t;
+typedef struct node_positions node_positions_t;
+typedef struct node_reclaimer node_reclaimer_t;
 
 /**
  * Structs
 **/
 typedef int (*compare_func_t)(const void *, const void *);
+typedef int (*compare_r_func_t)(const void *, const void *, void *);
+typedef uint64_t (*key_func_t)(const void *);
+typedef uint64_t (*key_r_func_t)(const void *, void *);
 
 /**
  * Represents a node in a linked list.
@@ -53,22 +62,131 @@ typedef struct linked_list {
     node_t *head;
     node_t *tail;
     size_t size;
+    node_pool_t *pool;
+    node_index_t *index;
+    node_positions_t *positions;
+    size_t elem_size;
+    compare_func_t sorted_by;
+    compare_r_func_t sorted_by_r;
+    void *sorted_ctx;
+    node_reclaimer_t *reclaimer;
 } linked_list_t;
 
+/**
+ * Represents a position in a linked list, on a node or past the last one.
+ */
+typedef struct linked_list_cursor {
+    linked_list_t *list;
+    node_t *node;
+    size_t position;
+} linked_list_cursor_t;
+
+/**
+ * Represents the progress of a budgeted operation resumed over several steps.
+ */
+typedef struct linked_list_step {
+    node_t *node;
+    node_t *other;
+    size_t position;
+    size_t width;
+    size_t left;
+    size_t right;
+    size_t size;
+    bool merging;
+    bool started;
+    bool done;
+} linked_list_step_t;
+
+/**
+ * Reports the cost of a linked list's data pointer index.
+ */
+typedef struct linked_list_index_stats {
+    size_t entries;
+    size_t capacity;
+    size_t memory;
+    size_t rehashes;
+    size_t rehashed_entries;
+} linked_list_index_stats_t;
+
+/**
+ * Reports the memory held by a pooled linked list's chunks.
+ */
+typedef struct linked_list_pool_stats {
+    size_t chunks;
+    size_t capacity;
+    size_t memory;
+} linked_list_pool_stats_t;
+
 /**
  * Functions
  */
 linked_list_t* linked_list_new();
 int linked_list_free(linked_list_t *list);
 int linked_list_init(linked_list_t *list);
+int linked_list_init_pooled(linked_list_t *list, size_t chunk_size);
+int linked_list_init_sized(linked_list_t *list, size_t elem_size);
+int linked_list_init_sized_pooled(linked_list_t *list, size_t elem_size, size_t chunk_size);
+int linked_list_init_arena(linked_list_t *list, size_t chunk_size);
+int linked_list_init_sized_arena(linked_list_t *list, size_t elem_size, size_t chunk_size);
 int linked_list_destroy(linked_list_t *list);
+int linked_list_set_reclaimer(linked_list_t *list, node_reclaimer_t *reclaimer);
 
 int linked_list_insert(linked_list_t *list, void *data);
+int linked_list_push_front(linked_list_t *list, void *data);
+int linked_list_insert_many(linked_list_t *list, void **items, size_t count);
+int linked_list_extend(linked_list_t *dest, const linked_list_t *source);
+int linked_list_adopt(linked_list_t *list, node_t *first, node_t *last, size_t count);
+int linked_list_insert_at(linked_list_t *list, size_t index, void *data);
+// Logarithmic, enables positions the first time an insertion lands away from either end.
+int linked_list_insert_sorted(linked_list_t *list, void *data, compare_func_t compare);
+int linked_list_insert_sorted_r(linked_list_t *list, void *data, compare_r_func_t compare, void *ctx);
+int linked_list_mark_unsorted(linked_list_t *list);
+void* linked_list_at(linked_list_t *list, size_t index);
+void* linked_list_peek_front(const linked_list_t *list);
+void* linked_list_peek_back(const linked_list_t *list);
+void* linked_list_pop_front(linked_list_t *list);
+void* linked_list_pop_back(linked_list_t *list);
 int linked_list_remove(linked_list_t *list, void *data);
 int linked_list_remove_if(linked_list_t *list, void* data, bool (*predicate)(void *, void*));
 int linked_list_steal_if(linked_list_t *list, linked_list_t* dest, void* data, bool (*predicate)(void *, void*));
+int linked_list_steal_if_count(linked_list_t *list, linked_list_t* dest, void* data, bool (*predicate)(void *, void*), size_t* moved);
 int linked_list_steal(linked_list_t* source, linked_list_t* dest, size_t index);
+bool linked_list_contains(linked_list_t *list, void *data);
+int linked_list_splice(linked_list_t* dest, linked_list_t* source);
+int linked_list_splice_range(linked_list_t* dest, linked_list_t* source, node_t* first, node_t* last);
+int linked_list_split(linked_list_t* list, node_t* node, linked_list_t* dest);
 int linked_list_sort(linked_list_t *list, compare_func_t compare);
+int linked_list_sort_parallel(linked_list_t *list, compare_func_t compare, size_t threads);
+int linked_list_sort_by_key(linked_list_t *list, key_func_t key);
+int linked_list_sort_cached(linked_list_t *list, compare_func_t compare, key_func_t prefix);
+int linked_list_sort_r(linked_list_t *list, compare_r_func_t compare, void *ctx);
+int linked_list_sort_parallel_r(linked_list_t *list, compare_r_func_t compare, void *ctx, size_t threads);
+int linked_list_sort_by_key_r(linked_list_t *list, key_r_func_t key, void *ctx);
+int linked_list_sort_cached_r(linked_list_t *list, compare_r_func_t compare, void *ctx, key_r_func_t prefix);
 int linked_list_clear(linked_list_t *list);
 
+int linked_list_cursor_begin(linked_list_t *list, linked_list_cursor_t *cursor);
+int linked_list_cursor_end(linked_list_t *list, linked_list_cursor_t *cursor);
+int linked_list_cursor_next(linked_list_cursor_t *cursor);
+int linked_list_cursor_prev(linked_list_cursor_t *cursor);
+void* linked_list_cursor_get(const linked_list_cursor_t *cursor);
+int linked_list_cursor_insert_before(linked_list_cursor_t *cursor, void *data);
+int linked_list_cursor_insert_after(linked_list_cursor_t *cursor, void *data);
+int linked_list_cursor_erase(linked_list_cursor_t *cursor);
+
+int linked_list_step_init(linked_list_step_t *step);
+int linked_list_clear_step(linked_list_t *list, linked_list_step_t *step, size_t budget);
+int linked_list_remove_if_step(linked_list_t *list, linked_list_step_t *step, void* data, bool (*predicate)(void *, void*), size_t budget);
+int linked_list_steal_if_step(linked_list_t *list, linked_list_t* dest, linked_list_step_t *step, void* data, bool (*predicate)(void *, void*), size_t budget);
+int linked_list_sort_step(linked_list_t *list, linked_list_step_t *step, compare_func_t compare, size_t budget);
+int linked_list_sort_step_r(linked_list_t *list, linked_list_step_t *step, compare_r_func_t compare, void *ctx, size_t budget);
+
+int linked_list_enable_index(linked_list_t *list);
+int linked_list_disable_index(linked_list_t *list);
+int linked_list_index_stats(const linked_list_t *list, linked_list_index_stats_t *stats);
+int linked_list_pool_stats(const linked_list_t *list, linked_list_pool_stats_t *stats);
+
+int linked_list_enable_positions(linked_list_t *list);
+int linked_list_disable_positions(linked_list_t *list);
+
 #endif
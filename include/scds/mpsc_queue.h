@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_MPSC_QUEUE_H
+#define SCDS_MPSC_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Macros
+ */
+#define MPSC_QUEUE_CACHE_LINE 64
+
+/**
+ * Represents a lock-free multi-producer single-consumer queue of nodes linked through next.
+ *
+ * Producers swap themselves onto the tail and the consumer alone walks from the head, the
+ * two ends sit on separate cache lines. The stub node keeps the queue non-empty so pushing
+ * never has to touch the head.
+ */
+typedef struct mpsc_queue {
+    node_t *tail;
+    char tail_padding[MPSC_QUEUE_CACHE_LINE - sizeof(node_t *)];
+    node_t *head;
+    node_t stub;
+} mpsc_queue_t;
+
+/**
+ * Functions
+ */
+int mpsc_queue_init(mpsc_queue_t *queue);
+int mpsc_queue_destroy(mpsc_queue_t *queue);
+
+int mpsc_queue_push(mpsc_queue_t *queue, node_t *node);
+int mpsc_queue_push_data(mpsc_queue_t *queue, void *data);
+node_t* mpsc_queue_pop(mpsc_queue_t *queue);
+int mpsc_queue_drain(mpsc_queue_t *queue, linked_list_t *list, size_t max, size_t *drained);
+
+#endif
@@ -0,0 +1,58 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_NODE_RECLAIMER_H
+#define SCDS_NODE_RECLAIMER_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Represents a background thread freeing chains of nodes handed to it by linked lists.
+ */
+typedef struct node_reclaimer {
+    pthread_mutex_t lock;
+    pthread_cond_t pending_ready;
+    pthread_cond_t idle;
+    node_t *pending;
+    size_t submitted;
+    size_t reclaimed;
+    size_t freed;
+    bool stopping;
+    pthread_t thread;
+} node_reclaimer_t;
+
+/**
+ * Functions
+ */
+int node_reclaimer_init(node_reclaimer_t *reclaimer);
+int node_reclaimer_destroy(node_reclaimer_t *reclaimer);
+
+int node_reclaimer_submit(node_reclaimer_t *reclaimer, node_t *first, node_t *last);
+int node_reclaimer_wait(node_reclaimer_t *reclaimer);
+
+#endif
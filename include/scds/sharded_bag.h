@@ -0,0 +1,66 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_SHARDED_BAG_H
+#define SCDS_SHARDED_BAG_H
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Macros
+ */
+#define SHARDED_BAG_CACHE_LINE 64
+
+/**
+ * Represents one shard of a sharded bag, aligned to a cache line so shards don't share one.
+ */
+typedef struct sharded_bag_shard {
+    _Alignas(SHARDED_BAG_CACHE_LINE) pthread_mutex_t lock;
+    linked_list_t list;
+    size_t size;
+} sharded_bag_shard_t;
+
+/**
+ * Represents an unordered collection spread over several linked lists, each thread
+ * inserting into its own shard.
+ */
+typedef struct sharded_bag {
+    sharded_bag_shard_t *shards;
+    size_t count;
+} sharded_bag_t;
+
+/**
+ * Functions
+ */
+int sharded_bag_init(sharded_bag_t *bag, size_t shards);
+int sharded_bag_destroy(sharded_bag_t *bag);
+
+int sharded_bag_insert(sharded_bag_t *bag, void *data);
+size_t sharded_bag_size(const sharded_bag_t *bag);
+int sharded_bag_collect(sharded_bag_t *bag, linked_list_t *dest);
+
+#endif
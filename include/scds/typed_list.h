@@ -0,0 +1,631 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_TYPED_LIST_H
+#define SCDS_TYPED_LIST_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/**
+ * Macros
+ *
+ * SCDS_LIST_DEFINE(name, T, cmp) generates a doubly linked list of T named name_t whose
+ * nodes, name_node_t, hold the value inline rather than through a data pointer, saving an
+ * allocation and a pointer hop per element. cmp is a function or macro taking two const T
+ * pointers and returning less than, equal to or greater than zero, it is called directly
+ * so it can be inlined into name_sort, name_contains and name_remove.
+ *
+ * The generated static inline functions mirror linked_list.h: name_new, name_free,
+ * name_init, name_destroy, name_insert, name_insert_many, name_extend, name_insert_at,
+ * name_at, name_remove, name_remove_if, name_steal_if, name_steal_if_count, name_steal,
+ * name_contains, name_splice, name_splice_range, name_split, name_sort and name_clear.
+ * Values are passed and stored by copy, name_at returns a pointer to the stored value.
+ *
+ * Use SCDS_LIST_DECLARE and SCDS_LIST_DEFINE_FUNCTIONS separately to generate the types
+ * ahead of the functions.
+ */
+#define SCDS_LIST_DEFINE(name, T, cmp) \
+  SCDS_LIST_DECLARE(name, T) \
+  SCDS_LIST_DEFINE_FUNCTIONS(name, T, cmp)
+
+#define SCDS_LIST_DECLARE(name, T) \
+typedef struct name##_node name##_node_t; \
+\
+typedef bool (*name##_predicate_t)(T *, void *); \
+\
+/* Represents a node holding its value inline. */ \
+struct name##_node { \
+    T value; \
+    name##_node_t *next; \
+    name##_node_t *prev; \
+}; \
+\
+/* Represents a typed linked list. */ \
+typedef struct name { \
+    name##_node_t *head; \
+    name##_node_t *tail; \
+    size_t size; \
+} name##_t;
+
+#define SCDS_LIST_DEFINE_FUNCTIONS(name, T, cmp) \
+/* Module internal function to link a chain of count nodes, already linked to each other, onto the tail. */ \
+static inline void name##_attach_chain(name##_t *list, name##_node_t *first, name##_node_t *last, size_t count) { \
+  assert(list); \
+  assert(first); \
+  assert(last); \
+\
+  first->prev = list->tail; \
+  last->next = NULL; \
+\
+  if (list->tail == NULL) { \
+    list->head = first; \
+  } else { \
+    list->tail->next = first; \
+  } \
+\
+  list->tail = last; \
+  list->size += count; \
+} \
+\
+/* Module internal function to unlink a run of count nodes from first to last inclusive. */ \
+static inline void name##_detach_chain(name##_t *list, name##_node_t *first, name##_node_t *last, size_t count) { \
+  assert(list); \
+  assert(first); \
+  assert(last); \
+  assert(list->size >= count); \
+\
+  if (first->prev == NULL) { \
+    list->head = last->next; \
+  } else { \
+    first->prev->next = last->next; \
+  } \
+\
+  if (last->next == NULL) { \
+    list->tail = first->prev; \
+  } else { \
+    last->next->prev = first->prev; \
+  } \
+\
+  first->prev = NULL; \
+  last->next = NULL; \
+  list->size -= count; \
+} \
+\
+/* Module internal function to find the node at a position, walking from the nearer end. */ \
+static inline name##_node_t *name##_node_at(const name##_t *list, size_t index) { \
+  assert(list); \
+\
+  if (index >= list->size) { \
+    return NULL; \
+  } \
+\
+  name##_node_t *node = NULL; \
+\
+  if (index < list->size / 2) { \
+    node = list->head; \
+\
+    for (size_t i = 0; i < index; i++) { \
+      node = node->next; \
+    } \
+  } else { \
+    node = list->tail; \
+\
+    for (size_t i = list->size - 1; i > index; i--) { \
+      node = node->prev; \
+    } \
+  } \
+\
+  return node; \
+} \
+\
+/* Module internal function to free a chain of nodes linked through next. */ \
+static inline void name##_free_chain(name##_node_t *node) { \
+  while (node != NULL) { \
+    name##_node_t *next = node->next; \
+\
+    free(node); \
+\
+    node = next; \
+  } \
+} \
+\
+/* Module internal function to detach the next ascending run, reversing a strictly descending one. */ \
+static inline name##_node_t *name##_take_run(name##_node_t **remaining, name##_node_t **tail) { \
+  name##_node_t *head = *remaining; \
+  name##_node_t *current = head; \
+  name##_node_t *next = current->next; \
+\
+  if (next != NULL && cmp(&current->value, &next->value) > 0) { \
+    current->next = NULL; \
+\
+    while (next != NULL && cmp(&current->value, &next->value) > 0) { \
+      name##_node_t *after = next->next; \
+\
+      next->next = current; \
+      current = next; \
+      next = after; \
+    } \
+\
+    *remaining = next; \
+    *tail = head; \
+\
+    return current; \
+  } \
+\
+  while (next != NULL && cmp(&current->value, &next->value) <= 0) { \
+    current = next; \
+    next = current->next; \
+  } \
+\
+  current->next = NULL; \
+\
+  *remaining = next; \
+  *tail = current; \
+\
+  return head; \
+} \
+\
+/* Module internal function to stably merge two runs linked through next. */ \
+static inline name##_node_t *name##_merge_runs(name##_node_t *left, name##_node_t *right, name##_node_t **tail) { \
+  name##_node_t head; \
+  name##_node_t *last = &head; \
+\
+  while (left != NULL && right != NULL) { \
+    if (cmp(&left->value, &right->value) <= 0) { \
+      last->next = left; \
+      left = left->next; \
+    } else { \
+      last->next = right; \
+      right = right->next; \
+    } \
+\
+    last = last->next; \
+  } \
+\
+  last->next = left != NULL ? left : right; \
+\
+  while (last->next != NULL) { \
+    last = last->next; \
+  } \
+\
+  *tail = last; \
+\
+  return head.next; \
+} \
+\
+/* Initializes a typed list. */ \
+static inline int name##_init(name##_t *list) { \
+  assert(list); \
+\
+  list->head = NULL; \
+  list->tail = NULL; \
+  list->size = 0; \
+\
+  return 0; \
+} \
+\
+/* Create a new typed list, NULL on failure. */ \
+static inline name##_t *name##_new(void) { \
+  name##_t *list = malloc(sizeof(name##_t)); \
+\
+  if (list != NULL) { \
+    name##_init(list); \
+  } \
+\
+  return list; \
+} \
+\
+/* Clears a typed list. */ \
+static inline int name##_clear(name##_t *list) { \
+  assert(list); \
+\
+  name##_free_chain(list->head); \
+\
+  return name##_init(list); \
+} \
+\
+/* Destroys a typed list. */ \
+static inline int name##_destroy(name##_t *list) { \
+  return name##_clear(list); \
+} \
+\
+/* Frees an allocated typed list. */ \
+static inline int name##_free(name##_t *list) { \
+  assert(list); \
+\
+  name##_destroy(list); \
+  free(list); \
+\
+  return 0; \
+} \
+\
+/* Inserts a copy of a value at the end of a typed list. */ \
+static inline int name##_insert(name##_t *list, T value) { \
+  assert(list); \
+\
+  name##_node_t *node = NULL; \
+\
+  if ((node = malloc(sizeof(name##_node_t))) == NULL) { \
+    return -1; \
+  } \
+\
+  node->value = value; \
+  name##_attach_chain(list, node, node, 1); \
+\
+  return 0; \
+} \
+\
+/* Inserts copies of count values, either all of them or, on failure, none. */ \
+static inline int name##_insert_many(name##_t *list, const T *items, size_t count) { \
+  assert(list); \
+  assert(items || count == 0); \
+\
+  if (count == 0) { \
+    return 0; \
+  } \
+\
+  name##_node_t head; \
+  name##_node_t *last = &head; \
+\
+  head.next = NULL; \
+\
+  for (size_t i = 0; i < count; i++) { \
+    name##_node_t *node = NULL; \
+\
+    if ((node = malloc(sizeof(name##_node_t))) == NULL) { \
+      last->next = NULL; \
+      name##_free_chain(head.next); \
+\
+      return -1; \
+    } \
+\
+    node->value = items[i]; \
+    node->prev = last; \
+    last->next = node; \
+    last = node; \
+  } \
+\
+  name##_attach_chain(list, head.next, last, count); \
+\
+  return 0; \
+} \
+\
+/* Appends copies of the values held by another typed list. */ \
+static inline int name##_extend(name##_t *dest, const name##_t *source) { \
+  assert(dest); \
+  assert(source); \
+  assert(dest != source); \
+\
+  name##_node_t head; \
+  name##_node_t *last = &head; \
+\
+  head.next = NULL; \
+\
+  for (const name##_node_t *from = source->head; from != NULL; from = from->next) { \
+    name##_node_t *node = NULL; \
+\
+    if ((node = malloc(sizeof(name##_node_t))) == NULL) { \
+      last->next = NULL; \
+      name##_free_chain(head.next); \
+\
+      return -1; \
+    } \
+\
+    node->value = from->value; \
+    node->prev = last; \
+    last->next = node; \
+    last = node; \
+  } \
+\
+  if (source->size > 0) { \
+    name##_attach_chain(dest, head.next, last, source->size); \
+  } \
+\
+  return 0; \
+} \
+\
+/* Inserts a copy of a value at a position up to and including the size of the list. */ \
+static inline int name##_insert_at(name##_t *list, size_t index, T value) { \
+  assert(list); \
+\
+  if (index > list->size) { \
+    return -1; \
+  } \
+\
+  if (index == list->size) { \
+    return name##_insert(list, value); \
+  } \
+\
+  name##_node_t *next = name##_node_at(list, index); \
+  name##_node_t *node = NULL; \
+\
+  if ((node = malloc(sizeof(name##_node_t))) == NULL) { \
+    return -1; \
+  } \
+\
+  node->value = value; \
+  node->next = next; \
+  node->prev = next->prev; \
+\
+  if (next->prev == NULL) { \
+    list->head = node; \
+  } else { \
+    next->prev->next = node; \
+  } \
+\
+  next->prev = node; \
+  list->size++; \
+\
+  return 0; \
+} \
+\
+/* Gets the value at a position, NULL if the position is out of range. */ \
+static inline T *name##_at(name##_t *list, size_t index) { \
+  name##_node_t *node = name##_node_at(list, index); \
+\
+  return node != NULL ? &node->value : NULL; \
+} \
+\
+/* Checks whether a typed list holds a value comparing equal to the given one. */ \
+static inline bool name##_contains(const name##_t *list, T value) { \
+  assert(list); \
+\
+  for (const name##_node_t *node = list->head; node != NULL; node = node->next) { \
+    if (cmp(&node->value, &value) == 0) { \
+      return true; \
+    } \
+  } \
+\
+  return false; \
+} \
+\
+/* Removes the first value comparing equal to the given one, -1 if there is none. */ \
+static inline int name##_remove(name##_t *list, T value) { \
+  assert(list); \
+\
+  for (name##_node_t *node = list->head; node != NULL; node = node->next) { \
+    if (cmp(&node->value, &value) == 0) { \
+      name##_detach_chain(list, node, node, 1); \
+      free(node); \
+\
+      return 0; \
+    } \
+  } \
+\
+  return -1; \
+} \
+\
+/* Removes the values matching a predicate. */ \
+static inline int name##_remove_if(name##_t *list, void *data, name##_predicate_t predicate) { \
+  assert(list); \
+  assert(predicate); \
+\
+  name##_node_t *node = list->head; \
+\
+  while (node != NULL) { \
+    name##_node_t *next = node->next; \
+\
+    if (predicate(&node->value, data)) { \
+      name##_detach_chain(list, node, node, 1); \
+      free(node); \
+    } \
+\
+    node = next; \
+  } \
+\
+  return 0; \
+} \
+\
+/* Transfers the values matching a predicate, moving consecutive matches as a run, counting them. */ \
+static inline int name##_steal_if_count(name##_t *list, name##_t *dest, void *data, name##_predicate_t predicate, size_t *moved) { \
+  assert(list); \
+  assert(dest); \
+  assert(list != dest); \
+  assert(predicate); \
+\
+  name##_node_t *node = list->head; \
+  size_t total = 0; \
+\
+  while (node != NULL) { \
+    if (!predicate(&node->value, data)) { \
+      node = node->next; \
+\
+      continue; \
+    } \
+\
+    name##_node_t *last = node; \
+    size_t count = 1; \
+\
+    while (last->next != NULL && predicate(&last->next->value, data)) { \
+      last = last->next; \
+      count++; \
+    } \
+\
+    name##_node_t *next = last->next; \
+\
+    name##_detach_chain(list, node, last, count); \
+    name##_attach_chain(dest, node, last, count); \
+\
+    total += count; \
+\
+    /* The node ending the run is already known not to match. */ \
+    node = next != NULL ? next->next : NULL; \
+  } \
+\
+  if (moved != NULL) { \
+    *moved = total; \
+  } \
+\
+  return 0; \
+} \
+\
+/* Transfers the values matching a predicate. */ \
+static inline int name##_steal_if(name##_t *list, name##_t *dest, void *data, name##_predicate_t predicate) { \
+  return name##_steal_if_count(list, dest, data, predicate, NULL); \
+} \
+\
+/* Transfers the node at a position onto the end of another typed list. */ \
+static inline int name##_steal(name##_t *source, name##_t *dest, size_t index) { \
+  assert(source); \
+  assert(dest); \
+\
+  name##_node_t *node = NULL; \
+\
+  if ((node = name##_node_at(source, index)) == NULL) { \
+    return -1; \
+  } \
+\
+  name##_detach_chain(source, node, node, 1); \
+  name##_attach_chain(dest, node, node, 1); \
+\
+  return 0; \
+} \
+\
+/* Moves every node of one typed list onto the end of another in constant time. */ \
+static inline int name##_splice(name##_t *dest, name##_t *source) { \
+  assert(dest); \
+  assert(source); \
+  assert(dest != source); \
+\
+  if (source->size == 0) { \
+    return 0; \
+  } \
+\
+  name##_node_t *first = source->head; \
+  name##_node_t *last = source->tail; \
+  size_t count = source->size; \
+\
+  name##_detach_chain(source, first, last, count); \
+  name##_attach_chain(dest, first, last, count); \
+\
+  return 0; \
+} \
+\
+/* Moves the nodes from first to last inclusive onto the end of another typed list. */ \
+static inline int name##_splice_range(name##_t *dest, name##_t *source, name##_node_t *first, name##_node_t *last) { \
+  assert(dest); \
+  assert(source); \
+  assert(dest != source); \
+  assert(first); \
+  assert(last); \
+\
+  size_t count = 1; \
+\
+  for (name##_node_t *node = first; node != last; node = node->next) { \
+    assert(node->next); \
+\
+    count++; \
+  } \
+\
+  name##_detach_chain(source, first, last, count); \
+  name##_attach_chain(dest, first, last, count); \
+\
+  return 0; \
+} \
+\
+/* Splits a typed list in two, moving node and every node after it onto the end of dest. */ \
+static inline int name##_split(name##_t *list, name##_node_t *node, name##_t *dest) { \
+  assert(list); \
+  assert(node); \
+  assert(dest); \
+  assert(list != dest); \
+\
+  name##_node_t *from_node = node; \
+  name##_node_t *from_head = list->head; \
+  size_t steps = 0; \
+\
+  while (from_node != NULL && from_head != node) { \
+    from_node = from_node->next; \
+    from_head = from_head->next; \
+    steps++; \
+  } \
+\
+  size_t count = from_node == NULL ? steps : list->size - steps; \
+  name##_node_t *last = list->tail; \
+\
+  name##_detach_chain(list, node, last, count); \
+  name##_attach_chain(dest, node, last, count); \
+\
+  return 0; \
+} \
+\
+/* Sorts a typed list with a stable natural merge sort, calling the comparator directly. */ \
+static inline int name##_sort(name##_t *list) { \
+  assert(list); \
+\
+  if (list->size <= 1) { \
+    return 0; \
+  } \
+\
+  name##_node_t *head = list->head; \
+  size_t runs = 0; \
+\
+  do { \
+    name##_node_t *remaining = head; \
+    name##_node_t *tail = NULL; \
+\
+    runs = 0; \
+\
+    while (remaining != NULL) { \
+      name##_node_t *run_tail = NULL; \
+      name##_node_t *run = name##_take_run(&remaining, &run_tail); \
+\
+      runs++; \
+\
+      if (remaining != NULL) { \
+        name##_node_t *other_tail = NULL; \
+        name##_node_t *other = name##_take_run(&remaining, &other_tail); \
+\
+        runs++; \
+\
+        run = name##_merge_runs(run, other, &run_tail); \
+      } \
+\
+      if (tail == NULL) { \
+        head = run; \
+      } else { \
+        tail->next = run; \
+      } \
+\
+      tail = run_tail; \
+    } \
+  } while (runs > 2); \
+\
+  name##_node_t *prev = NULL; \
+\
+  for (name##_node_t *node = head; node != NULL; node = node->next) { \
+    node->prev = prev; \
+    prev = node; \
+  } \
+\
+  list->head = head; \
+  list->tail = prev; \
+\
+  return 0; \
+}
+
+#endif
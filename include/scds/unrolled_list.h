@@ -0,0 +1,80 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_UNROLLED_LIST_H
+#define SCDS_UNROLLED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Macros
+ */
+#define UNROLLED_BLOCK_SLOTS 29
+#define UNROLLED_BLOCK_ALIGNMENT 64
+
+/**
+ * Typedefs
+ */
+typedef struct unrolled_block unrolled_block_t;
+
+/**
+ * Represents a cache line aligned block of data in an unrolled list.
+ */
+typedef struct unrolled_block {
+    void *slots[UNROLLED_BLOCK_SLOTS];
+    size_t count;
+    unrolled_block_t *next;
+    unrolled_block_t *prev;
+} unrolled_block_t;
+
+/**
+ * Represents an unrolled linked list.
+ */
+typedef struct unrolled_list {
+    unrolled_block_t *head;
+    unrolled_block_t *tail;
+    size_t size;
+} unrolled_list_t;
+
+/**
+ * Functions
+ */
+unrolled_list_t* unrolled_list_new();
+int unrolled_list_free(unrolled_list_t *list);
+int unrolled_list_init(unrolled_list_t *list);
+int unrolled_list_destroy(unrolled_list_t *list);
+
+int unrolled_list_insert(unrolled_list_t *list, void *data);
+int unrolled_list_remove(unrolled_list_t *list, void *data);
+bool unrolled_list_contains(unrolled_list_t *list, void *data);
+int unrolled_list_remove_if(unrolled_list_t *list, void *data, bool (*predicate)(void *, void *));
+int unrolled_list_steal_if(unrolled_list_t *list, unrolled_list_t *dest, void *data, bool (*predicate)(void *, void *));
+int unrolled_list_sort(unrolled_list_t *list, compare_func_t compare);
+int unrolled_list_sort_r(unrolled_list_t *list, compare_r_func_t compare, void *ctx);
+int unrolled_list_clear(unrolled_list_t *list);
+
+#endif
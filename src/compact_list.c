@@ -0,0 +1,538 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "scds/compact_list.h"
+#include "comparator.h"
+
+static uint32_t alloc_node(compact_list_t* list);
+static void release_node(compact_list_t* list, uint32_t index);
+static uint32_t find_node(compact_list_t* list, void* data);
+static void attach_node(compact_list_t* list, uint32_t index);
+static void detach_node(compact_list_t* list, uint32_t index);
+static int filter(compact_list_t* list, compact_list_t* dest, void* data, bool (*predicate)(void *, void*));
+static int sort_nodes(compact_list_t* list, const comparator_t* comparator);
+
+/**
+ * @brief Create a new compact list.
+ *
+ * @return A pointer to the newly created compact list.
+ */
+compact_list_t* compact_list_new() {
+  compact_list_t* list = malloc(sizeof(compact_list_t));
+
+  compact_list_init(list);
+
+  return list;
+}
+
+/**
+ * @brief Frees an allocated compact list.
+ *
+ * @param list The compact list to free.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_free(compact_list_t *list) {
+  assert(list);
+
+  compact_list_destroy(list);
+
+  free(list);
+
+  return 0;
+}
+
+/**
+ * @brief Initializes a compact list.
+ *
+ * @param list The compact list to initialize.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_init(compact_list_t *list) {
+  assert(list);
+
+  list->nodes = NULL;
+  list->head = COMPACT_LIST_NIL;
+  list->tail = COMPACT_LIST_NIL;
+  list->free_list = COMPACT_LIST_NIL;
+  list->used = 0;
+  list->capacity = 0;
+  list->size = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Destroys a compact list, releasing its node array.
+ *
+ * @param list The compact list to destroy.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_destroy(compact_list_t *list) {
+  assert(list);
+
+  free(list->nodes);
+
+  return compact_list_init(list);
+}
+
+/**
+ * @brief Grows the node array of a compact list to hold at least capacity nodes.
+ *
+ * @param list The compact list to grow.
+ * @param capacity The number of nodes to make room for.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_reserve(compact_list_t *list, size_t capacity) {
+  assert(list);
+
+  if (capacity <= list->capacity) {
+    return 0;
+  }
+
+  if (capacity >= COMPACT_LIST_NIL) {
+    return -1;
+  }
+
+  compact_node_t* nodes = NULL;
+
+  if ((nodes = realloc(list->nodes, capacity * sizeof(compact_node_t))) == NULL) {
+    return -1;
+  }
+
+  list->nodes = nodes;
+  list->capacity = (uint32_t) capacity;
+
+  return 0;
+}
+
+/**
+ * @brief Inserts data into a compact list.
+ *
+ * @param list The compact list to insert into.
+ * @param data The data to insert.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_insert(compact_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  uint32_t index = COMPACT_LIST_NIL;
+
+  if ((index = alloc_node(list)) == COMPACT_LIST_NIL) {
+    return -1;
+  }
+
+  list->nodes[index].data = data;
+
+  attach_node(list, index);
+
+  return 0;
+}
+
+/**
+ * @brief Removes data from a compact list.
+ *
+ * @param list The compact list to remove from.
+ * @param data The data to remove.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_remove(compact_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  uint32_t index = COMPACT_LIST_NIL;
+
+  if ((index = find_node(list, data)) == COMPACT_LIST_NIL) {
+    return -1;
+  }
+
+  detach_node(list, index);
+  release_node(list, index);
+
+  return 0;
+}
+
+/**
+ * @brief Checks whether a compact list holds the given data.
+ *
+ * @param list The compact list to search.
+ * @param data The data to find.
+ * @return true if the data is held by the list, false otherwise.
+ */
+bool compact_list_contains(compact_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  return find_node(list, data) != COMPACT_LIST_NIL;
+}
+
+/**
+ * @brief Removes nodes from a compact list that match a given predicate.
+ *
+ * @param list The compact list to remove from.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_remove_if(compact_list_t *list, void *data, bool (*predicate)(void *, void *)) {
+  assert(list);
+  assert(predicate);
+
+  return filter(list, NULL, data, predicate);
+}
+
+/**
+ * @brief Transfer data from one compact list to another when the predicate is true.
+ *
+ * @param list The compact list to remove from.
+ * @param dest The compact list to transfer to.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_steal_if(compact_list_t *list, compact_list_t *dest, void *data, bool (*predicate)(void *, void *)) {
+  assert(list);
+  assert(dest);
+  assert(list != dest);
+  assert(predicate);
+
+  return filter(list, dest, data, predicate);
+}
+
+/**
+ * @brief Transfer the data at the given index to another compact list.
+ *
+ * @param source The compact list to remove from.
+ * @param dest The compact list to transfer to.
+ * @param index The index of the data to transfer.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_steal(compact_list_t *source, compact_list_t *dest, size_t index) {
+  assert(source);
+  assert(dest);
+
+  if (index >= source->size) {
+    return -1;
+  }
+
+  uint32_t node = source->head;
+
+  for (size_t i = 0; i < index; i++) {
+    node = source->nodes[node].next;
+  }
+
+  if (compact_list_insert(dest, source->nodes[node].data) == -1) {
+    return -1;
+  }
+
+  detach_node(source, node);
+  release_node(source, node);
+
+  return 0;
+}
+
+/**
+ * @brief Sorts nodes in a compact list by a given comparator.
+ *
+ * Node indices are sorted in a contiguous array with a stable merge sort and the list is
+ * relinked in a single pass.
+ *
+ * @param list The compact list to sort.
+ * @param compare The comparator to use.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_sort(compact_list_t *list, compare_func_t compare) {
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return sort_nodes(list, &comparator);
+}
+
+/**
+ * @brief Sorts nodes in a compact list by a given comparator taking a user context.
+ *
+ * Behaves as compact_list_sort, passing ctx to every comparison.
+ *
+ * @param list The compact list to sort.
+ * @param compare The comparator to use.
+ * @param ctx The context passed to the comparator.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_sort_r(compact_list_t *list, compare_r_func_t compare, void *ctx) {
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return sort_nodes(list, &comparator);
+}
+
+/**
+ * @brief Clears a compact list in constant time, keeping its node array.
+ *
+ * @param list The compact list to clear.
+ * @return 0 on success, -1 on failure.
+ */
+int compact_list_clear(compact_list_t *list) {
+  assert(list);
+
+  list->head = COMPACT_LIST_NIL;
+  list->tail = COMPACT_LIST_NIL;
+  list->free_list = COMPACT_LIST_NIL;
+  list->used = 0;
+  list->size = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to take an unlinked node from the array.
+ *
+ * @param list The compact list to take the node from.
+ * @return The index of the node or COMPACT_LIST_NIL on failure.
+ */
+uint32_t alloc_node(compact_list_t* list) {
+  assert(list);
+
+  if (list->free_list != COMPACT_LIST_NIL) {
+    uint32_t index = list->free_list;
+    list->free_list = list->nodes[index].next;
+
+    return index;
+  }
+
+  if (list->used == list->capacity) {
+    size_t capacity = list->capacity > 0 ? (size_t) list->capacity * 2 : 16;
+
+    if (capacity >= COMPACT_LIST_NIL) {
+      capacity = COMPACT_LIST_NIL - 1;
+    }
+
+    if (capacity <= list->capacity || compact_list_reserve(list, capacity) == -1) {
+      return COMPACT_LIST_NIL;
+    }
+  }
+
+  return list->used++;
+}
+
+/**
+ * @brief Module internal function to return an unlinked node to the free list.
+ *
+ * @param list The compact list the node belongs to.
+ * @param index The index of the node.
+ */
+void release_node(compact_list_t* list, uint32_t index) {
+  assert(list);
+
+  list->nodes[index].next = list->free_list;
+  list->free_list = index;
+}
+
+/**
+ * @brief Module internal function to find the node holding the given data.
+ *
+ * @param list The compact list to search.
+ * @param data The data to find.
+ * @return The index of the node or COMPACT_LIST_NIL if there is none.
+ */
+uint32_t find_node(compact_list_t* list, void* data) {
+  assert(list);
+
+  for (uint32_t index = list->head; index != COMPACT_LIST_NIL; index = list->nodes[index].next) {
+    if (list->nodes[index].data == data) {
+      return index;
+    }
+  }
+
+  return COMPACT_LIST_NIL;
+}
+
+/**
+ * @brief Module internal function to attach a node to the end of a compact list.
+ *
+ * @param list The compact list to attach the node to.
+ * @param index The index of the node.
+ */
+void attach_node(compact_list_t* list, uint32_t index) {
+  assert(list);
+
+  compact_node_t* node = &list->nodes[index];
+
+  node->next = COMPACT_LIST_NIL;
+  node->prev = list->tail;
+
+  if (list->tail != COMPACT_LIST_NIL) {
+    list->nodes[list->tail].next = index;
+  } else {
+    list->head = index;
+  }
+
+  list->tail = index;
+  list->size++;
+}
+
+/**
+ * @brief Module internal function to detach a node from a compact list.
+ *
+ * @param list The compact list to detach the node from.
+ * @param index The index of the node.
+ */
+void detach_node(compact_list_t* list, uint32_t index) {
+  assert(list);
+
+  compact_node_t* node = &list->nodes[index];
+
+  if (node->prev != COMPACT_LIST_NIL) {
+    list->nodes[node->prev].next = node->next;
+  } else {
+    list->head = node->next;
+  }
+
+  if (node->next != COMPACT_LIST_NIL) {
+    list->nodes[node->next].prev = node->prev;
+  } else {
+    list->tail = node->prev;
+  }
+
+  list->size--;
+}
+
+/**
+ * @brief Module internal function to remove or transfer nodes matching a predicate.
+ *
+ * @param list The compact list to filter.
+ * @param dest The compact list to transfer matches to, NULL to discard them.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int filter(compact_list_t* list, compact_list_t* dest, void* data, bool (*predicate)(void *, void*)) {
+  assert(list);
+  assert(list != dest);
+  assert(predicate);
+
+  uint32_t index = list->head;
+
+  while (index != COMPACT_LIST_NIL) {
+    uint32_t next = list->nodes[index].next;
+
+    if (predicate(list->nodes[index].data, data)) {
+      if (dest != NULL && compact_list_insert(dest, list->nodes[index].data) == -1) {
+        return -1;
+      }
+
+      detach_node(list, index);
+      release_node(list, index);
+    }
+
+    index = next;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to sort nodes in a compact list through an array of node indices.
+ *
+ * @param list The compact list to sort.
+ * @param comparator The comparator to use.
+ * @return 0 on success, -1 on failure.
+ */
+int sort_nodes(compact_list_t* list, const comparator_t* comparator) {
+  assert(list);
+  assert(comparator);
+
+  if (list->size <= 1) {
+    return 0;
+  }
+
+  size_t count = list->size;
+  uint32_t* from = NULL;
+
+  if ((from = malloc(count * 2 * sizeof(uint32_t))) == NULL) {
+    return -1;
+  }
+
+  uint32_t* buffer = from;
+  uint32_t* to = from + count;
+  size_t i = 0;
+
+  for (uint32_t index = list->head; index != COMPACT_LIST_NIL; index = list->nodes[index].next) {
+    from[i++] = index;
+  }
+
+  for (size_t width = 1; width < count; width *= 2) {
+    for (size_t start = 0; start < count; start += width * 2) {
+      size_t middle = start + width < count ? start + width : count;
+      size_t end = middle + width < count ? middle + width : count;
+      size_t left = start;
+      size_t right = middle;
+      size_t out = start;
+
+      while (left < middle && right < end) {
+        if (comparator_compare(comparator, list->nodes[from[left]].data, list->nodes[from[right]].data) <= 0) {
+          to[out++] = from[left++];
+        } else {
+          to[out++] = from[right++];
+        }
+      }
+
+      while (left < middle) {
+        to[out++] = from[left++];
+      }
+
+      while (right < end) {
+        to[out++] = from[right++];
+      }
+    }
+
+    uint32_t* swap = from;
+    from = to;
+    to = swap;
+  }
+
+  uint32_t prev = COMPACT_LIST_NIL;
+
+  for (i = 0; i < count; i++) {
+    list->nodes[from[i]].prev = prev;
+
+    if (prev != COMPACT_LIST_NIL) {
+      list->nodes[prev].next = from[i];
+    }
+
+    prev = from[i];
+  }
+
+  list->nodes[prev].next = COMPACT_LIST_NIL;
+  list->head = from[0];
+  list->tail = prev;
+
+  free(buffer);
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_COMPARATOR_H
+#define SCDS_COMPARATOR_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Structs
+ */
+
+/**
+ * Represents a comparator that either takes a user context or doesn't, so sorts can be
+ * shared by both without an extra indirect call per comparison.
+ */
+typedef struct comparator {
+  compare_func_t compare;
+  compare_r_func_t compare_r;
+  void *ctx;
+} comparator_t;
+
+/**
+ * Functions
+ */
+
+/**
+ * @brief Compares two values with a comparator.
+ * 
+ * @param comparator The comparator to use.
+ * @param a The first value.
+ * @param b The second value.
+ * @return Less than, equal to or greater than zero as a orders before, with or after b.
+ */
+static inline int comparator_compare(const comparator_t *comparator, const void *a, const void *b) {
+  assert(comparator);
+
+  if (comparator->compare != NULL) {
+    return comparator->compare(a, b);
+  }
+
+  return comparator->compare_r(a, b, comparator->ctx);
+}
+
+/**
+ * @brief Checks whether a linked list is known to be sorted by a comparator.
+ * 
+ * @param list The linked list.
+ * @param comparator The comparator.
+ * @return true if the list was last sorted by the same function and context, false otherwise.
+ */
+static inline bool comparator_sorted(const linked_list_t *list, const comparator_t *comparator) {
+  assert(list);
+  assert(comparator);
+
+  if (comparator->compare != NULL) {
+    return list->sorted_by == comparator->compare;
+  }
+
+  return list->sorted_by_r == comparator->compare_r && list->sorted_ctx == comparator->ctx;
+}
+
+/**
+ * @brief Records the comparator a linked list is sorted by.
+ * 
+ * @param list The linked list.
+ * @param comparator The comparator, or NULL if the list isn't known to be sorted.
+ */
+static inline void comparator_mark_sorted(linked_list_t *list, const comparator_t *comparator) {
+  assert(list);
+
+  list->sorted_by = comparator != NULL ? comparator->compare : NULL;
+  list->sorted_by_r = comparator != NULL ? comparator->compare_r : NULL;
+  list->sorted_ctx = comparator != NULL ? comparator->ctx : NULL;
+}
+
+#endif
@@ -0,0 +1,633 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "scds/concurrent_list.h"
+
+static void append_chain(concurrent_list_t* list, concurrent_node_t* first, concurrent_node_t* last, size_t count);
+static void unlink_node(concurrent_list_t* list, concurrent_node_t* prev, concurrent_node_t* node, concurrent_node_t** retired);
+static void retire_chain(concurrent_list_t* list, concurrent_node_t* first);
+static void reclaim(concurrent_list_t* list);
+static void free_chain(concurrent_node_t* node);
+
+/**
+ * @brief Initializes a concurrent list.
+ * 
+ * @param list The concurrent list to initialize.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_init(concurrent_list_t *list) {
+  assert(list);
+
+  if (pthread_mutex_init(&list->lock, NULL) != 0) {
+    return -1;
+  }
+
+  list->head = NULL;
+  list->epoch = 1;
+  list->tail = NULL;
+  list->size = 0;
+  list->readers = NULL;
+  list->retired_head = NULL;
+  list->retired_tail = NULL;
+
+  return 0;
+}
+
+/**
+ * @brief Destroys a concurrent list, freeing every node including those awaiting reclamation.
+ *
+ * No other thread may be using the list.
+ * 
+ * @param list The concurrent list to destroy.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_destroy(concurrent_list_t *list) {
+  assert(list);
+
+  free_chain(list->head);
+
+  for (concurrent_node_t* node = list->retired_head; node != NULL; ) {
+    concurrent_node_t* next = node->retired;
+    free(node);
+    node = next;
+  }
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  list->readers = NULL;
+  list->retired_head = NULL;
+  list->retired_tail = NULL;
+
+  pthread_mutex_destroy(&list->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Registers a reader with a concurrent list, each reading thread needs its own.
+ * 
+ * @param list The concurrent list to read.
+ * @param reader The reader record, owned by the caller until unregistered.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_register(concurrent_list_t *list, concurrent_reader_t *reader) {
+  assert(list);
+  assert(reader);
+
+  __atomic_store_n(&reader->epoch, 0, __ATOMIC_RELAXED);
+
+  pthread_mutex_lock(&list->lock);
+
+  reader->next = list->readers;
+  list->readers = reader;
+
+  pthread_mutex_unlock(&list->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Unregisters a reader from a concurrent list, outside of a read section.
+ * 
+ * @param list The concurrent list being read.
+ * @param reader The reader record.
+ * @return 0 on success, -1 if the reader isn't registered.
+ */
+int concurrent_list_unregister(concurrent_list_t *list, concurrent_reader_t *reader) {
+  assert(list);
+  assert(reader);
+
+  int result = -1;
+
+  pthread_mutex_lock(&list->lock);
+
+  for (concurrent_reader_t** link = &list->readers; *link != NULL; link = &(*link)->next) {
+    if (*link == reader) {
+      *link = reader->next;
+      result = 0;
+
+      break;
+    }
+  }
+
+  if (result == 0) {
+    reclaim(list);
+  }
+
+  pthread_mutex_unlock(&list->lock);
+
+  return result;
+}
+
+/**
+ * @brief Enters a read section, nodes reached within it stay valid until it is left.
+ *
+ * Never blocks. Read sections shouldn't be held for long, they hold up reclamation.
+ * 
+ * @param list The concurrent list to read.
+ * @param reader The registered reader record of the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_read_lock(concurrent_list_t *list, concurrent_reader_t *reader) {
+  assert(list);
+  assert(reader);
+
+  uint64_t epoch = __atomic_load_n(&list->epoch, __ATOMIC_SEQ_CST);
+
+  __atomic_store_n(&reader->epoch, epoch, __ATOMIC_SEQ_CST);
+
+  // The epoch must be published before any node is loaded.
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  return 0;
+}
+
+/**
+ * @brief Leaves a read section.
+ * 
+ * @param reader The registered reader record of the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_read_unlock(concurrent_reader_t *reader) {
+  assert(reader);
+
+  __atomic_store_n(&reader->epoch, 0, __ATOMIC_RELEASE);
+
+  return 0;
+}
+
+/**
+ * @brief Gets the first node of a concurrent list, within a read section.
+ * 
+ * @param list The concurrent list to read.
+ * @return The first node or NULL if the list is empty.
+ */
+concurrent_node_t* concurrent_list_first(concurrent_list_t *list) {
+  assert(list);
+
+  return __atomic_load_n(&list->head, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Gets the node after a node, within the read section the node was reached in.
+ * 
+ * @param node The current node.
+ * @return The next node or NULL at the end of the list.
+ */
+concurrent_node_t* concurrent_list_next(concurrent_node_t *node) {
+  assert(node);
+
+  return __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Checks whether a concurrent list holds the given data, without locking.
+ * 
+ * @param list The concurrent list to search.
+ * @param reader The registered reader record of the calling thread.
+ * @param data The data to find.
+ * @return true if the data is held by the list, false otherwise.
+ */
+bool concurrent_list_contains(concurrent_list_t *list, concurrent_reader_t *reader, void *data) {
+  assert(list);
+  assert(reader);
+
+  bool found = false;
+
+  concurrent_list_read_lock(list, reader);
+
+  for (concurrent_node_t* node = concurrent_list_first(list); node != NULL; node = concurrent_list_next(node)) {
+    if (node->data == data) {
+      found = true;
+
+      break;
+    }
+  }
+
+  concurrent_list_read_unlock(reader);
+
+  return found;
+}
+
+/**
+ * @brief Visits the data of a concurrent list in order within a single read section.
+ *
+ * Data inserted or removed concurrently may or may not be visited.
+ * 
+ * @param list The concurrent list to visit.
+ * @param reader The registered reader record of the calling thread.
+ * @param ctx Contextual data for the visitor.
+ * @param visit The visitor, returning false to stop early.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_for_each(concurrent_list_t *list, concurrent_reader_t *reader, void *ctx, bool (*visit)(void *, void *)) {
+  assert(list);
+  assert(reader);
+  assert(visit);
+
+  concurrent_list_read_lock(list, reader);
+
+  for (concurrent_node_t* node = concurrent_list_first(list); node != NULL; node = concurrent_list_next(node)) {
+    if (!visit(node->data, ctx)) {
+      break;
+    }
+  }
+
+  concurrent_list_read_unlock(reader);
+
+  return 0;
+}
+
+/**
+ * @brief Gets the number of nodes in a concurrent list, which may change straight away.
+ * 
+ * @param list The concurrent list.
+ * @return The number of nodes.
+ */
+size_t concurrent_list_size(concurrent_list_t *list) {
+  assert(list);
+
+  return __atomic_load_n(&list->size, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Inserts data at the end of a concurrent list.
+ * 
+ * @param list The concurrent list to insert into.
+ * @param data The data to insert.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_insert(concurrent_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  concurrent_node_t* node = NULL;
+
+  if ((node = malloc(sizeof(concurrent_node_t))) == NULL) {
+    return -1;
+  }
+
+  node->data = data;
+  node->next = NULL;
+  node->retired = NULL;
+  node->retired_epoch = 0;
+
+  pthread_mutex_lock(&list->lock);
+
+  append_chain(list, node, node, 1);
+
+  pthread_mutex_unlock(&list->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Removes data from a concurrent list, its node is reclaimed once no reader can see it.
+ * 
+ * @param list The concurrent list to remove from.
+ * @param data The data to remove.
+ * @return 0 on success, -1 if the data isn't held by the list.
+ */
+int concurrent_list_remove(concurrent_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  concurrent_node_t* retired = NULL;
+  concurrent_node_t* prev = NULL;
+
+  pthread_mutex_lock(&list->lock);
+
+  for (concurrent_node_t* node = list->head; node != NULL; prev = node, node = node->next) {
+    if (node->data == data) {
+      unlink_node(list, prev, node, &retired);
+
+      break;
+    }
+  }
+
+  retire_chain(list, retired);
+
+  pthread_mutex_unlock(&list->lock);
+
+  return retired != NULL ? 0 : -1;
+}
+
+/**
+ * @brief Removes nodes from a concurrent list that match a given predicate.
+ * 
+ * @param list The concurrent list to remove from.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_remove_if(concurrent_list_t *list, void *data, bool (*predicate)(void *, void *)) {
+  assert(list);
+  assert(predicate);
+
+  concurrent_node_t* retired = NULL;
+  concurrent_node_t* prev = NULL;
+
+  pthread_mutex_lock(&list->lock);
+
+  for (concurrent_node_t* node = list->head; node != NULL; node = node->next) {
+    if (predicate(node->data, data)) {
+      unlink_node(list, prev, node, &retired);
+    } else {
+      prev = node;
+    }
+  }
+
+  retire_chain(list, retired);
+
+  pthread_mutex_unlock(&list->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Transfer data from one concurrent list to another when the predicate is true.
+ *
+ * Readers may traverse a removed node, so the data is moved into new nodes that are
+ * published to dest in a single step once the source lock is released. Meanwhile readers
+ * see the data in neither list.
+ * 
+ * @param list The concurrent list to remove from.
+ * @param dest The concurrent list to transfer to.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure, in which case the data matched so far is moved.
+ */
+int concurrent_list_steal_if(concurrent_list_t *list, concurrent_list_t *dest, void *data, bool (*predicate)(void *, void *)) {
+  assert(list);
+  assert(dest);
+  assert(list != dest);
+  assert(predicate);
+
+  concurrent_node_t* retired = NULL;
+  concurrent_node_t* prev = NULL;
+  concurrent_node_t* first = NULL;
+  concurrent_node_t* last = NULL;
+  size_t count = 0;
+  int result = 0;
+
+  pthread_mutex_lock(&list->lock);
+
+  for (concurrent_node_t* node = list->head; node != NULL; node = node->next) {
+    if (!predicate(node->data, data)) {
+      prev = node;
+
+      continue;
+    }
+
+    concurrent_node_t* copy = NULL;
+
+    if ((copy = malloc(sizeof(concurrent_node_t))) == NULL) {
+      result = -1;
+
+      break;
+    }
+
+    copy->data = node->data;
+    copy->next = NULL;
+    copy->retired = NULL;
+    copy->retired_epoch = 0;
+
+    if (last == NULL) {
+      first = copy;
+    } else {
+      last->next = copy;
+    }
+
+    last = copy;
+    count++;
+
+    unlink_node(list, prev, node, &retired);
+  }
+
+  retire_chain(list, retired);
+
+  pthread_mutex_unlock(&list->lock);
+
+  if (count > 0) {
+    pthread_mutex_lock(&dest->lock);
+
+    append_chain(dest, first, last, count);
+
+    pthread_mutex_unlock(&dest->lock);
+  }
+
+  return result;
+}
+
+/**
+ * @brief Removes every node from a concurrent list.
+ * 
+ * @param list The concurrent list to clear.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_clear(concurrent_list_t *list) {
+  assert(list);
+
+  pthread_mutex_lock(&list->lock);
+
+  concurrent_node_t* first = list->head;
+
+  __atomic_store_n(&list->head, NULL, __ATOMIC_RELEASE);
+  __atomic_store_n(&list->size, 0, __ATOMIC_RELAXED);
+
+  list->tail = NULL;
+
+  for (concurrent_node_t* node = first; node != NULL; node = node->next) {
+    node->retired = node->next;
+  }
+
+  retire_chain(list, first);
+
+  pthread_mutex_unlock(&list->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Frees the removed nodes of a concurrent list that no reader can still see.
+ *
+ * Writers reclaim as they remove, this catches up once readers have moved on.
+ * 
+ * @param list The concurrent list.
+ * @return 0 on success, -1 on failure.
+ */
+int concurrent_list_reclaim(concurrent_list_t *list) {
+  assert(list);
+
+  pthread_mutex_lock(&list->lock);
+
+  reclaim(list);
+
+  pthread_mutex_unlock(&list->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to publish a chain of nodes linked through next at the end of a list.
+ *
+ * Called with the list locked. The chain becomes visible to readers in a single store.
+ * 
+ * @param list The concurrent list to append to.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ * @param count The number of nodes in the chain.
+ */
+void append_chain(concurrent_list_t* list, concurrent_node_t* first, concurrent_node_t* last, size_t count) {
+  assert(list);
+  assert(first);
+  assert(last);
+
+  if (list->tail != NULL) {
+    __atomic_store_n(&list->tail->next, first, __ATOMIC_RELEASE);
+  } else {
+    __atomic_store_n(&list->head, first, __ATOMIC_RELEASE);
+  }
+
+  list->tail = last;
+
+  __atomic_store_n(&list->size, list->size + count, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Module internal function to unlink a node, leaving its next for readers still on it.
+ *
+ * Called with the list locked.
+ * 
+ * @param list The concurrent list holding the node.
+ * @param prev The node before it or NULL if it is the head.
+ * @param node The node to unlink.
+ * @param retired In out parameter holding the chain of nodes unlinked, linked through retired.
+ */
+void unlink_node(concurrent_list_t* list, concurrent_node_t* prev, concurrent_node_t* node, concurrent_node_t** retired) {
+  assert(list);
+  assert(node);
+  assert(retired);
+
+  if (prev != NULL) {
+    __atomic_store_n(&prev->next, node->next, __ATOMIC_RELEASE);
+  } else {
+    __atomic_store_n(&list->head, node->next, __ATOMIC_RELEASE);
+  }
+
+  if (list->tail == node) {
+    list->tail = prev;
+  }
+
+  __atomic_store_n(&list->size, list->size - 1, __ATOMIC_RELAXED);
+
+  node->retired = *retired;
+  *retired = node;
+}
+
+/**
+ * @brief Module internal function to stamp unlinked nodes with a new epoch and queue them for reclamation.
+ *
+ * Called with the list locked. Readers entering from the new epoch on can't reach the nodes.
+ * 
+ * @param list The concurrent list the nodes were unlinked from.
+ * @param first The first node of the chain linked through retired, or NULL for none.
+ */
+void retire_chain(concurrent_list_t* list, concurrent_node_t* first) {
+  assert(list);
+
+  if (first == NULL) {
+    return;
+  }
+
+  uint64_t epoch = __atomic_add_fetch(&list->epoch, 1, __ATOMIC_SEQ_CST);
+  concurrent_node_t* last = first;
+
+  for (concurrent_node_t* node = first; node != NULL; node = node->retired) {
+    node->retired_epoch = epoch;
+    last = node;
+  }
+
+  if (list->retired_tail != NULL) {
+    list->retired_tail->retired = first;
+  } else {
+    list->retired_head = first;
+  }
+
+  list->retired_tail = last;
+
+  reclaim(list);
+}
+
+/**
+ * @brief Module internal function to free retired nodes older than every active read section.
+ *
+ * Called with the list locked.
+ * 
+ * @param list The concurrent list.
+ */
+void reclaim(concurrent_list_t* list) {
+  assert(list);
+
+  // Unlinks must be visible before reader epochs are read.
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  uint64_t oldest = UINT64_MAX;
+
+  for (concurrent_reader_t* reader = list->readers; reader != NULL; reader = reader->next) {
+    uint64_t epoch = __atomic_load_n(&reader->epoch, __ATOMIC_SEQ_CST);
+
+    if (epoch != 0 && epoch < oldest) {
+      oldest = epoch;
+    }
+  }
+
+  while (list->retired_head != NULL && list->retired_head->retired_epoch <= oldest) {
+    concurrent_node_t* node = list->retired_head;
+
+    list->retired_head = node->retired;
+    free(node);
+  }
+
+  if (list->retired_head == NULL) {
+    list->retired_tail = NULL;
+  }
+}
+
+/**
+ * @brief Module internal function to free a chain of nodes linked through next.
+ * 
+ * @param node The first node of the chain.
+ */
+void free_chain(concurrent_node_t* node) {
+  while (node != NULL) {
+    concurrent_node_t* next = node->next;
+    free(node);
+    node = next;
+  }
+}
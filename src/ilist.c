@@ -0,0 +1,206 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "scds/ilist.h"
+
+/**
+ * @brief Initializes an intrusive list.
+ *
+ * @param list The intrusive list to initialize.
+ * @return 0 on success, -1 on failure.
+ */
+int ilist_init(ilist_t *list) {
+  assert(list);
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Links an object onto the end of an intrusive list, no memory is allocated.
+ *
+ * @param list The intrusive list to insert into.
+ * @param link The link embedded in the object to insert.
+ * @return 0 on success, -1 on failure.
+ */
+int ilist_insert(ilist_t *list, ilist_link_t *link) {
+  assert(list);
+  assert(link);
+
+  if (list->size == 0) {
+    list->head = link;
+    list->tail = link;
+
+    link->prev = NULL;
+  } else {
+    list->tail->next = link;
+    link->prev = list->tail;
+    list->tail = link;
+  }
+
+  link->next = NULL;
+
+  list->size++;
+
+  return 0;
+}
+
+/**
+ * @brief Unlinks an object from an intrusive list in constant time.
+ *
+ * @param list The intrusive list the object is linked into.
+ * @param link The link embedded in the object to remove.
+ * @return 0 on success, -1 on failure.
+ */
+int ilist_remove(ilist_t *list, ilist_link_t *link) {
+  assert(list);
+  assert(link);
+  assert(list->size > 0);
+
+  if (link->prev != NULL) {
+    link->prev->next = link->next;
+  } else {
+    list->head = link->next;
+  }
+
+  if (link->next != NULL) {
+    link->next->prev = link->prev;
+  } else {
+    list->tail = link->prev;
+  }
+
+  link->prev = NULL;
+  link->next = NULL;
+
+  list->size--;
+
+  return 0;
+}
+
+/**
+ * @brief Unlinks objects from an intrusive list that match a given predicate.
+ *
+ * @param list The intrusive list to remove from.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @param dispose Optional function called with each unlinked object, may be NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int ilist_remove_if(ilist_t *list, void *data, ilist_predicate_t predicate, ilist_dispose_t dispose) {
+  assert(list);
+  assert(predicate);
+
+  ilist_link_t *link = list->head;
+
+  while (link != NULL) {
+    ilist_link_t *next = link->next;
+
+    if (predicate(link, data)) {
+      if (ilist_remove(list, link) == -1) {
+        return -1;
+      }
+
+      if (dispose != NULL) {
+        dispose(link);
+      }
+    }
+
+    link = next;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Transfer objects from one intrusive list to another when the predicate is true.
+ *
+ * @param list The intrusive list to remove from.
+ * @param dest The intrusive list to transfer to.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int ilist_steal_if(ilist_t *list, ilist_t *dest, void *data, ilist_predicate_t predicate) {
+  assert(list);
+  assert(dest);
+  assert(predicate);
+
+  ilist_link_t *link = list->head;
+
+  while (link != NULL) {
+    ilist_link_t *next = link->next;
+
+    if (predicate(link, data)) {
+      if (ilist_remove(list, link) == -1) {
+        return -1;
+      }
+
+      if (ilist_insert(dest, link) == -1) {
+        return -1;
+      }
+    }
+
+    link = next;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Unlinks every object from an intrusive list.
+ *
+ * @param list The intrusive list to clear.
+ * @param dispose Optional function called with each unlinked object, may be NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int ilist_clear(ilist_t *list, ilist_dispose_t dispose) {
+  assert(list);
+
+  ilist_link_t *link = list->head;
+
+  while (link != NULL) {
+    ilist_link_t *next = link->next;
+
+    link->prev = NULL;
+    link->next = NULL;
+
+    if (dispose != NULL) {
+      dispose(link);
+    }
+
+    link = next;
+  }
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+
+  return 0;
+}
@@ -23,19 +23,59 @@ SOFTWARE.
 */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
 #include "scds/linked_list.h"
+#include "scds/node_reclaimer.h"
+#include "comparator.h"
+#include "node_index.h"
+#include "node_pool.h"
+#include "node_positions.h"
 
+#define UNKNOWN_POSITION SIZE_MAX
+
+#if defined(__GNUC__)
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address) ((void) (address))
+#endif
+
+/**
+ * Represents a node of a sized list, the element is copied into the same allocation and
+ * the node's data points at it.
+ */
+typedef struct sized_node {
+  node_t node;
+  max_align_t payload[];
+} sized_node_t;
+
+static size_t node_size(const linked_list_t* list);
+static void set_data(const linked_list_t* list, node_t* node, void* data);
+static node_t* alloc_node(linked_list_t* list);
+static void release_node(linked_list_t* list, node_t* node);
+static int alloc_chain(linked_list_t* list, size_t count, node_t** first, node_t** last);
+static int attach_chain(linked_list_t* list, node_t* first, node_t* last, size_t count);
+static void release_chain(linked_list_t* list, node_t* first);
+static void detach_chain(linked_list_t* list, node_t* first, node_t* last, size_t count);
+static int move_chain(linked_list_t* source, linked_list_t* dest, node_t* first, node_t* last, size_t count);
+static bool shares_nodes(const linked_list_t* source, const linked_list_t* dest);
+static node_t* find_node(linked_list_t* list, void* data);
 static node_t* node_at(linked_list_t* list, size_t index);
 static int attach_node(linked_list_t* list, node_t* node);
-static int detach_node(linked_list_t* list, node_t* node);
-static int steal_node(linked_list_t* source, linked_list_t* dest, node_t* node);
-static int quick_sort(linked_list_t* list, node_t* start, node_t* end, compare_func_t compare);
-static node_t* partition(linked_list_t* list, node_t* start, node_t* end, node_t** new_start, node_t** new_end, compare_func_t compare);
-static int insert_after(linked_list_t* list, node_t* after, node_t* node);
+static int detach_node(linked_list_t* list, node_t* node, size_t position);
+static int steal_node(linked_list_t* source, linked_list_t* dest, node_t* node, size_t position);
+static int link_before(linked_list_t* list, node_t* next, node_t* node);
+static int insert_before(linked_list_t* list, node_t* next, void* data, size_t position);
+static int insert_after(linked_list_t* list, node_t* after, void* data, size_t position);
+static size_t cursor_position(const linked_list_cursor_t* cursor);
+static void collect_node(node_t* node, node_t** first, node_t** last);
+static void release_batch(linked_list_t* list, node_t* first, node_t* last);
+static void* pop_node(linked_list_t* list, node_t* node, size_t position);
+static int insert_sorted(linked_list_t* list, void* data, const comparator_t* comparator);
+static node_t* sorted_successor(linked_list_t* list, void* data, const comparator_t* comparator, size_t* position);
 
 /**
  * @brief Create a new linked list.
@@ -59,7 +99,7 @@ linked_list_t* linked_list_new() {
 int linked_list_free(linked_list_t *list) {
   assert(list);
 
-  linked_list_clear(list);
+  linked_list_destroy(list);
 
   free(list);
 
@@ -80,6 +120,130 @@ int linked_list_init(linked_list_t *list) {
   list->head = NULL;
   list->tail = NULL;
   list->size = 0;
+  list->pool = NULL;
+  list->index = NULL;
+  list->positions = NULL;
+  list->elem_size = 0;
+  comparator_mark_sorted(list, NULL);
+  list->reclaimer = NULL;
+
+  return 0;
+}
+
+/**
+ * @brief Initializes a linked list whose nodes are carved from a private pool.
+ *
+ * Nodes are allocated in chunks of chunk_size and recycled through a freelist when
+ * removed, the chunks themselves are only released by linked_list_destroy.
+ *
+ * @param list The linked list to initialize.
+ * @param chunk_size The number of nodes per chunk, 0 for the default.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_init_pooled(linked_list_t *list, size_t chunk_size) {
+  assert(list);
+
+  linked_list_init(list);
+
+  if ((list->pool = node_pool_new(sizeof(node_t), chunk_size)) == NULL) {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Initializes a linked list that stores copies of fixed size elements in its nodes.
+ *
+ * linked_list_insert and friends copy elem_size bytes from the data given into the node's
+ * own allocation and node data points at the copy, so the caller needn't allocate each
+ * element. linked_list_remove and linked_list_contains compare element bytes, and the data
+ * pointer index isn't available. Nodes only move between sized lists of the same size.
+ *
+ * @param list The linked list to initialize.
+ * @param elem_size The size in bytes of each element.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_init_sized(linked_list_t *list, size_t elem_size) {
+  assert(list);
+  assert(elem_size > 0);
+
+  linked_list_init(list);
+
+  list->elem_size = elem_size;
+
+  return 0;
+}
+
+/**
+ * @brief Initializes a sized linked list whose nodes are carved from a private pool.
+ *
+ * Behaves as linked_list_init_sized with each node and its element sharing a pool slot.
+ *
+ * @param list The linked list to initialize.
+ * @param elem_size The size in bytes of each element.
+ * @param chunk_size The number of nodes per chunk, 0 for the default.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_init_sized_pooled(linked_list_t *list, size_t elem_size, size_t chunk_size) {
+  assert(list);
+
+  linked_list_init_sized(list, elem_size);
+
+  if ((list->pool = node_pool_new(node_size(list), chunk_size)) == NULL) {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Initializes a linked list whose nodes are bump allocated from a private arena.
+ *
+ * Behaves as linked_list_init_pooled except that chunks double in size as the list grows
+ * and linked_list_clear resets the arena rather than visiting each node, keeping only the
+ * largest chunk. linked_list_clear and linked_list_destroy cost one free per other chunk,
+ * which grows with the number of chunks rather than the number of nodes.
+ *
+ * @param list The linked list to initialize.
+ * @param chunk_size The number of nodes in the first chunk, 0 for the default.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_init_arena(linked_list_t *list, size_t chunk_size) {
+  assert(list);
+
+  linked_list_init(list);
+
+  if ((list->pool = node_pool_new_arena(sizeof(node_t), chunk_size)) == NULL) {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Initializes a sized linked list whose nodes are bump allocated from a private arena.
+ *
+ * Behaves as linked_list_init_arena with each node and its element sharing an arena slot.
+ *
+ * @param list The linked list to initialize.
+ * @param elem_size The size in bytes of each element.
+ * @param chunk_size The number of nodes in the first chunk, 0 for the default.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_init_sized_arena(linked_list_t *list, size_t elem_size, size_t chunk_size) {
+  assert(list);
+
+  linked_list_init_sized(list, elem_size);
+
+  if ((list->pool = node_pool_new_arena(node_size(list), chunk_size)) == NULL) {
+    return -1;
+  }
 
   return 0;
 }
@@ -96,6 +260,38 @@ int linked_list_destroy(linked_list_t *list) {
 
   linked_list_clear(list);
 
+  linked_list_disable_index(list);
+  linked_list_disable_positions(list);
+
+  if (list->pool != NULL) {
+    node_pool_free(list->pool);
+    list->pool = NULL;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Hands nodes removed from a linked list in bulk to a background thread to be freed.
+ *
+ * linked_list_clear, linked_list_destroy and the remove_if functions then only unlink
+ * nodes, passing them to the reclaimer as a single chain. Nodes removed one at a time are
+ * still freed by the caller. Pooled lists recycle their nodes and can't use a reclaimer.
+ * The reclaimer must outlive its use by the list.
+ * 
+ * @param list The linked list.
+ * @param reclaimer The node reclaimer to use, or NULL to free nodes on the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_set_reclaimer(linked_list_t *list, node_reclaimer_t *reclaimer) {
+  assert(list);
+
+  if (list->pool != NULL) {
+    return -1;
+  }
+
+  list->reclaimer = reclaimer;
+
   return 0;
 }
 
@@ -114,14 +310,14 @@ int linked_list_insert(linked_list_t *list, void *data) {
 
   node_t* node = NULL;
   
-  if ((node = malloc(sizeof(node_t))) == NULL) {
+  if ((node = alloc_node(list)) == NULL) {
     return -1;
   }
 
-  node->data = data;
+  set_data(list, node, data);
 
   if (attach_node(list, node) == -1) {
-    free(node);
+    release_node(list, node);
 
     return -1;
   }
@@ -130,172 +326,1537 @@ int linked_list_insert(linked_list_t *list, void *data) {
 }
 
 /**
- * @brief Removes data from a linked list.
+ * @brief Inserts data at the front of a linked list.
  * 
- * @param list The linked list to remove from.
- * @param data The data to remove.
+ * @param list The linked list to insert into.
+ * @param data The data to insert.
  *
  * @return 0 on success, -1 on failure.
  */
-int linked_list_remove(linked_list_t *list, void *data) {
+int linked_list_push_front(linked_list_t *list, void *data) {
   assert(list);
   assert(data);
 
-  for (node_t* node = list->head; node != NULL; node = node->next) {
-    if (node->data == data) {
-      if (detach_node(list, node) == -1) {
-        return -1;
-      }
+  return insert_before(list, list->head, data, 0);
+}
 
-      free(node);
+/**
+ * @brief Inserts a batch of data into a linked list.
+ *
+ * The nodes are allocated together, a pooled list takes them from at most one new
+ * chunk, pre-linked and attached to the tail in a single step.
+ * 
+ * @param list The linked list to insert into.
+ * @param items The data to insert.
+ * @param count The number of items.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_insert_many(linked_list_t *list, void **items, size_t count) {
+  assert(list);
+  assert(items || count == 0);
 
-      return 0;
-    }
+  if (count == 0) {
+    return 0;
   }
 
-  return -1;
+  node_t* first = NULL;
+  node_t* last = NULL;
+
+  if (alloc_chain(list, count, &first, &last) == -1) {
+    return -1;
+  }
+
+  node_t* prev = NULL;
+  size_t i = 0;
+
+  for (node_t* node = first; node != NULL; node = node->next) {
+    assert(items[i]);
+
+    set_data(list, node, items[i++]);
+    node->prev = prev;
+    prev = node;
+  }
+
+  if (attach_chain(list, first, last, count) == -1) {
+    release_chain(list, first);
+
+    return -1;
+  }
+
+  return 0;
 }
 
 /**
- * @brief Removes nodes from a linked list that match a given predicate.
+ * @brief Appends the data held by another linked list to a linked list.
  * 
- * @param list The linked list to remove from.
- * @param data Contextual data for the predicate.
- * @param predicate The predicate to use.
+ * @param dest The linked list to insert into.
+ * @param source The linked list whose data is inserted, it is left unchanged.
+ *
  * @return 0 on success, -1 on failure.
  */
-int linked_list_remove_if(linked_list_t *list, void* data, bool (*predicate)(void *, void*)) {
+int linked_list_extend(linked_list_t *dest, const linked_list_t *source) {
+  assert(dest);
+  assert(source);
+  assert(dest != source);
+
+  if (source->size == 0) {
+    return 0;
+  }
+
+  node_t* first = NULL;
+  node_t* last = NULL;
+
+  if (alloc_chain(dest, source->size, &first, &last) == -1) {
+    return -1;
+  }
+
+  node_t* prev = NULL;
+  node_t* from = source->head;
+
+  for (node_t* node = first; node != NULL; node = node->next) {
+    set_data(dest, node, from->data);
+    node->prev = prev;
+    prev = node;
+    from = from->next;
+  }
+
+  if (attach_chain(dest, first, last, source->size) == -1) {
+    release_chain(dest, first);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Appends a chain of nodes allocated with malloc, linked through next, to a linked list.
+ *
+ * An unpooled list of data pointers takes ownership of the nodes and links them in place.
+ * Any other list copies their data into nodes of its own and frees the originals. On
+ * failure the chain is left untouched and remains owned by the caller.
+ * 
+ * @param list The linked list to append to.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ * @param count The number of nodes in the chain.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_adopt(linked_list_t *list, node_t *first, node_t *last, size_t count) {
   assert(list);
-  assert(predicate);
+  assert(first);
+  assert(last);
+  assert(count > 0);
 
-  node_t* node = list->head;
+  if (list->pool == NULL && list->elem_size == 0) {
+    node_t* prev = NULL;
+    node_t* node = first;
 
-  while (node != NULL) {
-    if (!predicate(node->data, data)) {
-      node = node->next;
-      
-      continue;
+    for (size_t i = 0; i < count; i++, node = node->next) {
+      node->prev = prev;
+      prev = node;
     }
 
-    node_t* next = node->next;
+    assert(prev == last);
 
-    if (detach_node(list, node) == -1) {
-      return -1;
-    }
+    return attach_chain(list, first, last, count);
+  }
 
-    free(node);
+  node_t* copy_first = NULL;
+  node_t* copy_last = NULL;
 
-    node = next;
+  if (alloc_chain(list, count, &copy_first, &copy_last) == -1) {
+    return -1;
+  }
+
+  node_t* prev = NULL;
+  node_t* from = first;
+
+  for (node_t* node = copy_first; node != NULL; node = node->next) {
+    set_data(list, node, from->data);
+    node->prev = prev;
+    prev = node;
+    from = from->next;
+  }
+
+  if (attach_chain(list, copy_first, copy_last, count) == -1) {
+    release_chain(list, copy_first);
+
+    return -1;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    node_t* next = first->next;
+    free(first);
+    first = next;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Inserts data into a linked list at the given position.
+ * 
+ * @param list The linked list to insert into.
+ * @param index The position to insert at, up to and including the size of the list.
+ * @param data The data to insert.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_insert_at(linked_list_t *list, size_t index, void *data) {
+  assert(list);
+  assert(data);
+
+  if (index > list->size) {
+    return -1;
+  }
+
+  if (index == list->size) {
+    return linked_list_insert(list, data);
+  }
+
+  node_t* next = NULL;
+
+  if ((next = node_at(list, index)) == NULL) {
+    return -1;
+  }
+
+  return insert_before(list, next, data, index);
+}
+
+/**
+ * @brief Inserts data into a linked list sorted by a given comparator, after any equal data.
+ *
+ * A list not known to be sorted by the comparator is sorted first. The insertion point is
+ * found in constant time at either end and otherwise by a single descent of the positional
+ * index, which is enabled the first time it is needed, see linked_list_enable_positions.
+ * Should that fail it is found by walking back from the tail. The list stays marked as
+ * sorted until it is changed by other means. Changing the data it points at isn't
+ * tracked, call linked_list_mark_unsorted after doing so.
+ * 
+ * @param list The linked list to insert into.
+ * @param data The data to insert.
+ * @param compare The comparator the list is sorted by.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_insert_sorted(linked_list_t *list, void *data, compare_func_t compare) {
+  assert(list);
+  assert(data);
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return insert_sorted(list, data, &comparator);
+}
+
+/**
+ * @brief Inserts data into a linked list sorted by a given comparator taking a user context, after any equal data.
+ *
+ * Behaves as linked_list_insert_sorted, passing ctx to every comparison. The list is known
+ * to be sorted while the same comparator and context pointer are used, so the context
+ * must keep ordering data the same way for as long as the list is kept sorted.
+ * 
+ * @param list The linked list to insert into.
+ * @param data The data to insert.
+ * @param compare The comparator the list is sorted by.
+ * @param ctx The context passed to the comparator.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_insert_sorted_r(linked_list_t *list, void *data, compare_r_func_t compare, void *ctx) {
+  assert(list);
+  assert(data);
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return insert_sorted(list, data, &comparator);
+}
+
+/**
+ * @brief Forgets the comparator a linked list is known to be sorted by.
+ *
+ * The next linked_list_insert_sorted or linked_list_insert_sorted_r sorts the list first.
+ * Needed after changing the data a sorted list points at, which isn't tracked.
+ * 
+ * @param list The linked list.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_mark_unsorted(linked_list_t *list) {
+  assert(list);
+
+  comparator_mark_sorted(list, NULL);
+
+  return 0;
+}
+
+/**
+ * @brief Gets the data at the given position in a linked list.
+ * 
+ * @param list The linked list to get the data from.
+ * @param index The position of the data.
+ *
+ * @return The data at the position or NULL if the position is out of range.
+ */
+void* linked_list_at(linked_list_t *list, size_t index) {
+  assert(list);
+
+  if (index >= list->size) {
+    return NULL;
+  }
+
+  node_t* node = NULL;
+
+  if ((node = node_at(list, index)) == NULL) {
+    return NULL;
+  }
+
+  return node->data;
+}
+
+/**
+ * @brief Gets the data at the front of a linked list.
+ * 
+ * @param list The linked list to get the data from.
+ *
+ * @return The data at the front or NULL if the list is empty.
+ */
+void* linked_list_peek_front(const linked_list_t *list) {
+  assert(list);
+
+  return list->head != NULL ? list->head->data : NULL;
+}
+
+/**
+ * @brief Gets the data at the back of a linked list.
+ * 
+ * @param list The linked list to get the data from.
+ *
+ * @return The data at the back or NULL if the list is empty.
+ */
+void* linked_list_peek_back(const linked_list_t *list) {
+  assert(list);
+
+  return list->tail != NULL ? list->tail->data : NULL;
+}
+
+/**
+ * @brief Removes the front of a linked list and returns its data.
+ *
+ * Not supported by sized lists, whose data lives in the node being recycled.
+ * Use linked_list_peek_front to copy it out and a cursor to erase it instead.
+ * 
+ * @param list The linked list to remove from.
+ *
+ * @return The removed data or NULL if the list is empty or sized.
+ */
+void* linked_list_pop_front(linked_list_t *list) {
+  assert(list);
+
+  return pop_node(list, list->head, 0);
+}
+
+/**
+ * @brief Removes the back of a linked list and returns its data.
+ *
+ * Not supported by sized lists, whose data lives in the node being recycled.
+ * Use linked_list_peek_back to copy it out and a cursor to erase it instead.
+ * 
+ * @param list The linked list to remove from.
+ *
+ * @return The removed data or NULL if the list is empty or sized.
+ */
+void* linked_list_pop_back(linked_list_t *list) {
+  assert(list);
+
+  return pop_node(list, list->tail, list->size - 1);
+}
+
+/**
+ * @brief Removes data from a linked list.
+ * 
+ * @param list The linked list to remove from.
+ * @param data The data to remove.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_remove(linked_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  node_t* node = NULL;
+
+  if ((node = find_node(list, data)) == NULL) {
+    return -1;
+  }
+
+  if (detach_node(list, node, UNKNOWN_POSITION) == -1) {
+    return -1;
+  }
+
+  release_node(list, node);
+
+  return 0;
+}
+
+/**
+ * @brief Checks whether a linked list holds the given data.
+ * 
+ * @param list The linked list to search.
+ * @param data The data to find.
+ * @return true if the data is held by the list, false otherwise.
+ */
+bool linked_list_contains(linked_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  return find_node(list, data) != NULL;
+}
+
+/**
+ * @brief Removes nodes from a linked list that match a given predicate.
+ * 
+ * @param list The linked list to remove from.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_remove_if(linked_list_t *list, void* data, bool (*predicate)(void *, void*)) {
+  assert(list);
+  assert(predicate);
+
+  node_t* node = list->head;
+  node_t* first = NULL;
+  node_t* last = NULL;
+  int result = 0;
+
+  while (node != NULL) {
+    if (!predicate(node->data, data)) {
+      node = node->next;
+      
+      continue;
+    }
+
+    node_t* next = node->next;
+
+    if (detach_node(list, node, UNKNOWN_POSITION) == -1) {
+      result = -1;
+
+      break;
+    }
+
+    collect_node(node, &first, &last);
+
+    node = next;
+  }
+
+  release_batch(list, first, last);
+
+  return result;
+}
+
+/**
+ * @brief Transfer nodes from one linked list to another when the predicate is true.
+ * 
+ * @param list The linked list to remove from.
+ * @param dest The linked list to transfer to.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_steal_if(linked_list_t *list, linked_list_t* dest, void* data, bool (*predicate)(void *, void*)) {
+  assert(list);
+  assert(dest);
+  assert(predicate);
+
+  return linked_list_steal_if_count(list, dest, data, predicate, NULL);
+}
+
+/**
+ * @brief Transfer nodes from one linked list to another when the predicate is true, counting them.
+ *
+ * Consecutive matching nodes are moved as a single run, keeping them in source order.
+ * 
+ * @param list The linked list to remove from.
+ * @param dest The linked list to transfer to.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @param moved Optional out parameter containing the number of nodes moved, even on failure.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_steal_if_count(linked_list_t *list, linked_list_t* dest, void* data, bool (*predicate)(void *, void*), size_t* moved) {
+  assert(list);
+  assert(dest);
+  assert(list != dest);
+  assert(predicate);
+
+  node_t* node = list->head;
+  size_t total = 0;
+  int result = 0;
+
+  while (node != NULL) {
+    if (!predicate(node->data, data)) {
+      node = node->next;
+      
+      continue;
+    }
+
+    node_t* last = node;
+    size_t count = 1;
+
+    while (last->next != NULL && predicate(last->next->data, data)) {
+      last = last->next;
+      count++;
+    }
+
+    node_t* next = last->next;
+
+    if (move_chain(list, dest, node, last, count) == -1) {
+      result = -1;
+
+      break;
+    }
+
+    total += count;
+
+    // The node ending the run is already known not to match.
+    node = next != NULL ? next->next : NULL;
+  }
+
+  if (moved != NULL) {
+    *moved = total;
+  }
+
+  return result;
+}
+
+/**
+ * @brief Transfer the node at the given index to another linked list.
+ * 
+ * @param source The linked list to remove from.
+ * @param dest The linked list to transfer to.
+ * @param index The index of the node to transfer.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_steal(linked_list_t* source, linked_list_t* dest, size_t index) {
+  assert(source);
+  assert(dest);
+
+  node_t* node = NULL;
+
+  if ((node = node_at(source, index)) == NULL) {
+    return -1;
+  }
+
+  if (steal_node(source, dest, node, index) == -1) {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Moves every node of one linked list onto the end of another.
+ *
+ * Constant time unless either list is indexed by data pointer, which costs a constant
+ * amount per node moved, or the lists use different pools, in which case nodes are
+ * copied across one at a time.
+ * 
+ * @param dest The linked list to append to.
+ * @param source The linked list to empty.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_splice(linked_list_t* dest, linked_list_t* source) {
+  assert(dest);
+  assert(source);
+  assert(dest != source);
+
+  if (source->size == 0) {
+    return 0;
+  }
+
+  return move_chain(source, dest, source->head, source->tail, source->size);
+}
+
+/**
+ * @brief Moves the nodes from first to last inclusive onto the end of another linked list.
+ *
+ * The range is walked once to count it, otherwise the cost is as linked_list_splice.
+ * 
+ * @param dest The linked list to append to.
+ * @param source The linked list holding the range.
+ * @param first The first node of the range.
+ * @param last The last node of the range, at or after first.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_splice_range(linked_list_t* dest, linked_list_t* source, node_t* first, node_t* last) {
+  assert(dest);
+  assert(source);
+  assert(dest != source);
+  assert(first);
+  assert(last);
+
+  size_t count = 1;
+
+  for (node_t* node = first; node != last; node = node->next) {
+    assert(node->next);
+
+    count++;
+  }
+
+  return move_chain(source, dest, first, last, count);
+}
+
+/**
+ * @brief Splits a linked list in two, moving node and every node after it onto the end of dest.
+ *
+ * The shorter side of the split is walked once to count it, otherwise the cost is as
+ * linked_list_splice.
+ * 
+ * @param list The linked list to split.
+ * @param node The first node to move.
+ * @param dest The linked list to append to.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_split(linked_list_t* list, node_t* node, linked_list_t* dest) {
+  assert(list);
+  assert(node);
+  assert(dest);
+  assert(list != dest);
+
+  node_t* from_node = node;
+  node_t* from_head = list->head;
+  size_t steps = 0;
+
+  while (from_node != NULL && from_head != node) {
+    from_node = from_node->next;
+    from_head = from_head->next;
+    steps++;
+  }
+
+  size_t count = from_node == NULL ? steps : list->size - steps;
+
+  return move_chain(list, dest, node, list->tail, count);
+}
+
+/**
+ * @brief Places a cursor on the first node of a linked list, or past the end if it is empty.
+ * 
+ * @param list The linked list to walk.
+ * @param cursor The cursor to place.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_cursor_begin(linked_list_t *list, linked_list_cursor_t *cursor) {
+  assert(list);
+  assert(cursor);
+
+  cursor->list = list;
+  cursor->node = list->head;
+  cursor->position = 0;
+
+  if (cursor->node != NULL) {
+    PREFETCH(cursor->node->next);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Places a cursor past the last node of a linked list.
+ * 
+ * @param list The linked list to walk.
+ * @param cursor The cursor to place.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_cursor_end(linked_list_t *list, linked_list_cursor_t *cursor) {
+  assert(list);
+  assert(cursor);
+
+  cursor->list = list;
+  cursor->node = NULL;
+  cursor->position = list->size;
+
+  return 0;
+}
+
+/**
+ * @brief Moves a cursor to the next node, or past the end from the last node.
+ *
+ * The node after the new one is prefetched while the caller works on the current one.
+ * 
+ * @param cursor The cursor to move.
+ * @return 0 on success, -1 if the cursor is already past the end.
+ */
+int linked_list_cursor_next(linked_list_cursor_t *cursor) {
+  assert(cursor);
+
+  if (cursor->node == NULL) {
+    return -1;
+  }
+
+  cursor->node = cursor->node->next;
+  cursor->position++;
+
+  if (cursor->node != NULL) {
+    PREFETCH(cursor->node->next);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Moves a cursor to the previous node, or from past the end to the last node.
+ *
+ * The node before the new one is prefetched while the caller works on the current one.
+ * 
+ * @param cursor The cursor to move.
+ * @return 0 on success, -1 if the cursor is on the first node or the list is empty.
+ */
+int linked_list_cursor_prev(linked_list_cursor_t *cursor) {
+  assert(cursor);
+
+  node_t* prev = cursor->node != NULL ? cursor->node->prev : cursor->list->tail;
+
+  if (prev == NULL) {
+    return -1;
+  }
+
+  cursor->node = prev;
+  cursor->position--;
+
+  PREFETCH(prev->prev);
+
+  return 0;
+}
+
+/**
+ * @brief Gets the data at a cursor.
+ * 
+ * @param cursor The cursor.
+ * @return The data of the node at the cursor or NULL if it is past the end.
+ */
+void* linked_list_cursor_get(const linked_list_cursor_t *cursor) {
+  assert(cursor);
+
+  return cursor->node != NULL ? cursor->node->data : NULL;
+}
+
+/**
+ * @brief Inserts data in front of the node at a cursor, or at the end if the cursor is past it.
+ *
+ * Constant time, or logarithmic when positions are maintained. The cursor stays on its node.
+ * 
+ * @param cursor The cursor to insert at.
+ * @param data The data to insert.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_cursor_insert_before(linked_list_cursor_t *cursor, void *data) {
+  assert(cursor);
+  assert(data);
+
+  if (insert_before(cursor->list, cursor->node, data, cursor_position(cursor)) == -1) {
+    return -1;
+  }
+
+  cursor->position++;
+
+  return 0;
+}
+
+/**
+ * @brief Inserts data after the node at a cursor.
+ *
+ * Constant time, or logarithmic when positions are maintained. The cursor stays on its node.
+ * 
+ * @param cursor The cursor to insert at.
+ * @param data The data to insert.
+ * @return 0 on success, -1 on failure or if the cursor is past the end.
+ */
+int linked_list_cursor_insert_after(linked_list_cursor_t *cursor, void *data) {
+  assert(cursor);
+  assert(data);
+
+  if (cursor->node == NULL) {
+    return -1;
+  }
+
+  return insert_after(cursor->list, cursor->node, data, cursor_position(cursor));
+}
+
+/**
+ * @brief Removes the node at a cursor and moves the cursor on to the node that followed it.
+ *
+ * Constant time, or logarithmic when positions are maintained.
+ * 
+ * @param cursor The cursor to erase at.
+ * @return 0 on success, -1 on failure or if the cursor is past the end.
+ */
+int linked_list_cursor_erase(linked_list_cursor_t *cursor) {
+  assert(cursor);
+
+  node_t* node = cursor->node;
+
+  if (node == NULL) {
+    return -1;
+  }
+
+  node_t* next = node->next;
+
+  if (detach_node(cursor->list, node, cursor_position(cursor)) == -1) {
+    return -1;
+  }
+
+  release_node(cursor->list, node);
+
+  cursor->node = next;
+
+  return 0;
+}
+
+/**
+ * @brief Clears a linked list.
+ * 
+ * @param list The linked list to clear.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_clear(linked_list_t *list) {
+  assert(list);
+
+  if (list->pool != NULL && node_pool_is_arena(list->pool)) {
+    node_pool_reset(list->pool);
+  } else if (list->pool != NULL) {
+    if (list->head != NULL) {
+      node_pool_release_chain(list->pool, list->head, list->tail);
+    }
+  } else if (list->reclaimer != NULL) {
+    if (list->head != NULL) {
+      node_reclaimer_submit(list->reclaimer, list->head, list->tail);
+    }
+  } else {
+    node_t* node = list->head;
+
+    while (node != NULL) {
+      node_t* next = node->next;
+      free(node);
+      node = next;
+    }
+  }
+
+  if (list->index != NULL) {
+    node_index_clear(list->index);
+  }
+
+  if (list->positions != NULL) {
+    node_positions_clear(list->positions);
+  }
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Prepares a step for a new budgeted operation.
+ *
+ * A step is passed to repeated calls of the same budgeted operation on the same list,
+ * e.g. linked_list_remove_if_step, until its done flag is set. The list stays consistent
+ * between calls. Data may be appended to the list between calls to the clear, remove_if
+ * and steal_if steps, any other change requires the step to be prepared again.
+ * 
+ * @param step The step to prepare.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_step_init(linked_list_step_t *step) {
+  assert(step);
+
+  step->node = NULL;
+  step->other = NULL;
+  step->position = 0;
+  step->width = 0;
+  step->left = 0;
+  step->right = 0;
+  step->size = 0;
+  step->merging = false;
+  step->started = false;
+  step->done = false;
+
+  return 0;
+}
+
+/**
+ * @brief Clears a linked list a budget of nodes at a time.
+ *
+ * Nodes are released from the front. Pooled lists and lists with a reclaimer are cleared
+ * in a single step when not indexed, as linked_list_clear doesn't visit their nodes.
+ * 
+ * @param list The linked list to clear.
+ * @param step The step tracking progress, done once the list is empty.
+ * @param budget The maximum number of nodes to release.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_clear_step(linked_list_t *list, linked_list_step_t *step, size_t budget) {
+  assert(list);
+  assert(step);
+  assert(budget > 0);
+
+  step->started = true;
+
+  if ((list->pool != NULL || list->reclaimer != NULL) && list->index == NULL && list->positions == NULL) {
+    step->done = true;
+
+    return linked_list_clear(list);
+  }
+
+  node_t* first = NULL;
+  node_t* last = NULL;
+  int result = 0;
+
+  for (size_t visited = 0; visited < budget && list->head != NULL; visited++) {
+    node_t* node = list->head;
+
+    if (detach_node(list, node, 0) == -1) {
+      result = -1;
+
+      break;
+    }
+
+    collect_node(node, &first, &last);
+  }
+
+  release_batch(list, first, last);
+
+  step->done = list->head == NULL;
+
+  return result;
+}
+
+/**
+ * @brief Removes nodes from a linked list that match a given predicate, a budget of nodes at a time.
+ * 
+ * @param list The linked list to remove from.
+ * @param step The step tracking progress, done once every node has been visited.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @param budget The maximum number of nodes to visit.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_remove_if_step(linked_list_t *list, linked_list_step_t *step, void* data, bool (*predicate)(void *, void*), size_t budget) {
+  assert(list);
+  assert(step);
+  assert(predicate);
+  assert(budget > 0);
+
+  if (!step->started) {
+    step->node = list->head;
+    step->position = 0;
+    step->started = true;
+  }
+
+  node_t* first = NULL;
+  node_t* last = NULL;
+  int result = 0;
+
+  for (size_t visited = 0; visited < budget && step->node != NULL; visited++) {
+    node_t* node = step->node;
+    node_t* next = node->next;
+
+    if (predicate(node->data, data)) {
+      if (detach_node(list, node, step->position) == -1) {
+        result = -1;
+
+        break;
+      }
+
+      collect_node(node, &first, &last);
+    } else {
+      step->position++;
+    }
+
+    step->node = next;
+  }
+
+  release_batch(list, first, last);
+
+  step->done = step->node == NULL;
+
+  return result;
+}
+
+/**
+ * @brief Transfer nodes from one linked list to another when the predicate is true, a budget of nodes at a time.
+ * 
+ * @param list The linked list to remove from.
+ * @param dest The linked list to transfer to.
+ * @param step The step tracking progress, done once every node has been visited.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @param budget The maximum number of nodes to visit.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_steal_if_step(linked_list_t *list, linked_list_t* dest, linked_list_step_t *step, void* data, bool (*predicate)(void *, void*), size_t budget) {
+  assert(list);
+  assert(dest);
+  assert(step);
+  assert(predicate);
+  assert(budget > 0);
+
+  if (!step->started) {
+    step->node = list->head;
+    step->position = 0;
+    step->started = true;
+  }
+
+  for (size_t visited = 0; visited < budget && step->node != NULL; visited++) {
+    node_t* node = step->node;
+    node_t* next = node->next;
+
+    if (predicate(node->data, data)) {
+      if (steal_node(list, dest, node, step->position) == -1) {
+        return -1;
+      }
+    } else {
+      step->position++;
+    }
+
+    step->node = next;
+  }
+
+  step->done = step->node == NULL;
+
+  return 0;
+}
+
+/**
+ * @brief Maintains a hash index from data pointer to node for a linked list.
+ *
+ * Once enabled linked_list_remove and linked_list_contains are constant time. Where
+ * the same data is inserted more than once an arbitrary occurrence is removed.
+ * 
+ * @param list The linked list to index.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_enable_index(linked_list_t *list) {
+  assert(list);
+
+  if (list->index != NULL) {
+    return 0;
+  }
+
+  if (list->elem_size != 0) {
+    return -1;
+  }
+
+  node_index_t* index = NULL;
+
+  if ((index = node_index_new(list->size)) == NULL) {
+    return -1;
+  }
+
+  for (node_t* node = list->head; node != NULL; node = node->next) {
+    if (node_index_insert(index, node) == -1) {
+      node_index_free(index);
+
+      return -1;
+    }
+  }
+
+  list->index = index;
+
+  return 0;
+}
+
+/**
+ * @brief Stops maintaining the data pointer index of a linked list and frees it.
+ * 
+ * @param list The linked list to stop indexing.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_disable_index(linked_list_t *list) {
+  assert(list);
+
+  if (list->index != NULL) {
+    node_index_free(list->index);
+    list->index = NULL;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Reports the memory overhead and rehash cost of a linked list's index.
+ * 
+ * @param list The indexed linked list.
+ * @param stats Out parameter populated with the statistics.
+ * @return 0 on success, -1 if the list isn't indexed.
+ */
+int linked_list_index_stats(const linked_list_t *list, linked_list_index_stats_t *stats) {
+  assert(list);
+  assert(stats);
+
+  if (list->index == NULL) {
+    return -1;
+  }
+
+  return node_index_stats(list->index, stats);
+}
+
+/**
+ * @brief Reports the chunks and memory held by a pooled linked list.
+ * 
+ * @param list The pooled linked list.
+ * @param stats Out parameter populated with the statistics.
+ * @return 0 on success, -1 if the list isn't pooled.
+ */
+int linked_list_pool_stats(const linked_list_t *list, linked_list_pool_stats_t *stats) {
+  assert(list);
+  assert(stats);
+
+  if (list->pool == NULL) {
+    return -1;
+  }
+
+  return node_pool_stats(list->pool, stats);
+}
+
+/**
+ * @brief Maintains a positional index over a linked list.
+ *
+ * Once enabled positional access, linked_list_insert_at and linked_list_steal are
+ * logarithmic and appends remain amortised constant time. Removing nodes other than
+ * the head or tail by data or predicate, or sorting, causes the index to be rebuilt
+ * in linear time on the next positional access.
+ * 
+ * @param list The linked list to index.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_enable_positions(linked_list_t *list) {
+  assert(list);
+
+  if (list->positions != NULL) {
+    return 0;
+  }
+
+  if ((list->positions = node_positions_new()) == NULL) {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Stops maintaining the positional index of a linked list and frees it.
+ * 
+ * @param list The linked list to stop indexing.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_disable_positions(linked_list_t *list) {
+  assert(list);
+
+  if (list->positions != NULL) {
+    node_positions_free(list->positions);
+    list->positions = NULL;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to get the size of a linked list's node allocations.
+ * 
+ * @param list The linked list the nodes are for.
+ * @return The size in bytes of a node, including its element for a sized list.
+ */
+size_t node_size(const linked_list_t* list) {
+  assert(list);
+
+  if (list->elem_size == 0) {
+    return sizeof(node_t);
+  }
+
+  return sizeof(sized_node_t) + list->elem_size;
+}
+
+/**
+ * @brief Module internal function to set the data of a newly allocated node.
+ *
+ * A sized list copies the element into the node and points data at the copy.
+ * 
+ * @param list The linked list the node was allocated for.
+ * @param node The node to set the data of.
+ * @param data The data, or for a sized list the element to copy.
+ */
+void set_data(const linked_list_t* list, node_t* node, void* data) {
+  assert(list);
+  assert(node);
+
+  if (list->elem_size == 0) {
+    node->data = data;
+
+    return;
+  }
+
+  sized_node_t* sized = (sized_node_t*) node;
+
+  memcpy(sized->payload, data, list->elem_size);
+  node->data = sized->payload;
+}
+
+/**
+ * @brief Module internal function to allocate a node for a linked list.
+ * 
+ * @param list The linked list the node is for.
+ * @return The allocated node or NULL on failure.
+ */
+node_t* alloc_node(linked_list_t* list) {
+  assert(list);
+
+  if (list->pool != NULL) {
+    return node_pool_alloc(list->pool);
+  }
+
+  return malloc(node_size(list));
+}
+
+/**
+ * @brief Module internal function to release a node allocated by alloc_node.
+ * 
+ * @param list The linked list the node was allocated for.
+ * @param node The node to release.
+ */
+void release_node(linked_list_t* list, node_t* node) {
+  assert(list);
+  assert(node);
+
+  if (list->pool != NULL) {
+    node_pool_release(list->pool, node);
+
+    return;
+  }
+
+  free(node);
+}
+
+/**
+ * @brief Module internal function to allocate a chain of nodes linked through next.
+ * 
+ * @param list The linked list the nodes are for.
+ * @param count The number of nodes to allocate, at least one.
+ * @param first Out parameter containing the first node of the chain.
+ * @param last Out parameter containing the last node of the chain.
+ * @return 0 on success, -1 on failure.
+ */
+int alloc_chain(linked_list_t* list, size_t count, node_t** first, node_t** last) {
+  assert(list);
+  assert(count > 0);
+  assert(first);
+  assert(last);
+
+  if (list->pool != NULL) {
+    return node_pool_alloc_chain(list->pool, count, first, last);
+  }
+
+  node_t* head = NULL;
+  node_t* tail = NULL;
+
+  for (size_t i = 0; i < count; i++) {
+    node_t* node = NULL;
+
+    if ((node = alloc_node(list)) == NULL) {
+      if (head != NULL) {
+        release_chain(list, head);
+      }
+
+      return -1;
+    }
+
+    if (tail != NULL) {
+      tail->next = node;
+    } else {
+      head = node;
+    }
+
+    tail = node;
+  }
+
+  tail->next = NULL;
+
+  *first = head;
+  *last = tail;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to release a detached chain of nodes linked through next.
+ * 
+ * @param list The linked list the nodes were allocated for.
+ * @param first The first node of the chain.
+ */
+void release_chain(linked_list_t* list, node_t* first) {
+  assert(list);
+
+  while (first != NULL) {
+    node_t* next = first->next;
+    release_node(list, first);
+    first = next;
+  }
+}
+
+/**
+ * @brief Module internal function to attach a doubly linked chain to the end of a linked list.
+ * 
+ * @param list The linked list to attach the chain to.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ * @param count The number of nodes in the chain.
+ * @return 0 on success, -1 on failure.
+ */
+int attach_chain(linked_list_t* list, node_t* first, node_t* last, size_t count) {
+  assert(list);
+  assert(first);
+  assert(last);
+
+  if (list->index != NULL) {
+    node_t* node = first;
+
+    for (size_t i = 0; i < count; i++, node = node->next) {
+      if (node_index_insert(list->index, node) == 0) {
+        continue;
+      }
+
+      for (node_t* added = first; added != node; added = added->next) {
+        node_index_remove(list->index, added);
+      }
+
+      return -1;
+    }
+  }
+
+  if (list->positions != NULL && !node_positions_stale(list->positions)) {
+    node_t* node = first;
+
+    for (size_t i = 0; i < count; i++, node = node->next) {
+      if (node_positions_append(list->positions, node) == -1) {
+        node_positions_invalidate(list->positions);
+
+        break;
+      }
+    }
+  }
+
+  comparator_mark_sorted(list, NULL);
+
+  first->prev = list->tail;
+  last->next = NULL;
+
+  if (list->tail != NULL) {
+    list->tail->next = first;
+  } else {
+    list->head = first;
   }
 
+  list->tail = last;
+  list->size += count;
+
   return 0;
 }
 
 /**
- * @brief Transfer nodes from one linked list to another when the predicate is true.
+ * @brief Module internal function to unlink a run of count nodes from first to last.
  * 
- * @param list The linked list to remove from.
- * @param dest The linked list to transfer to.
- * @param data Contextual data for the predicate.
- * @param predicate The predicate to use.
- * @return 0 on success, -1 on failure.
+ * @param list The linked list holding the run.
+ * @param first The first node of the run.
+ * @param last The last node of the run.
+ * @param count The number of nodes in the run.
  */
-int linked_list_steal_if(linked_list_t *list, linked_list_t* dest, void* data, bool (*predicate)(void *, void*)) {
+void detach_chain(linked_list_t* list, node_t* first, node_t* last, size_t count) {
   assert(list);
-  assert(dest);
-  assert(predicate);
+  assert(first);
+  assert(last);
+  assert(count <= list->size);
 
-  node_t* node = list->head;
+  bool whole = count == list->size;
 
-  while (node != NULL) {
-    if (!predicate(node->data, data)) {
-      node = node->next;
-      
-      continue;
-    }
+  if (list->index != NULL) {
+    if (whole) {
+      node_index_clear(list->index);
+    } else {
+      node_t* node = first;
 
-    node_t* next = node->next;
+      for (size_t i = 0; i < count; i++, node = node->next) {
+        node_index_remove(list->index, node);
+      }
+    }
+  }
 
-    if (steal_node(list, dest, node) == -1) {
-      return -1;
+  if (list->positions != NULL) {
+    if (whole) {
+      node_positions_clear(list->positions);
+    } else {
+      node_positions_invalidate(list->positions);
     }
+  }
 
-    node = next;
+  if (first->prev != NULL) {
+    first->prev->next = last->next;
+  } else {
+    list->head = last->next;
   }
 
-  return 0;
+  if (last->next != NULL) {
+    last->next->prev = first->prev;
+  } else {
+    list->tail = first->prev;
+  }
+
+  first->prev = NULL;
+  last->next = NULL;
+
+  list->size -= count;
 }
 
 /**
- * @brief Transfer the node at the given index to another linked list.
+ * @brief Module internal function to move a run of count nodes onto the end of another list.
  * 
- * @param source The linked list to remove from.
- * @param dest The linked list to transfer to.
- * @param index The index of the node to transfer.
+ * @param source The linked list holding the run.
+ * @param dest The linked list to append to.
+ * @param first The first node of the run.
+ * @param last The last node of the run.
+ * @param count The number of nodes in the run.
  * @return 0 on success, -1 on failure.
  */
-int linked_list_steal(linked_list_t* source, linked_list_t* dest, size_t index) {
+int move_chain(linked_list_t* source, linked_list_t* dest, node_t* first, node_t* last, size_t count) {
   assert(source);
   assert(dest);
 
-  node_t* node = NULL;
+  if (!shares_nodes(source, dest)) {
+    node_t* end = last->next;
+    node_t* node = first;
 
-  if ((node = node_at(source, index)) == NULL) {
-    return -1;
-  }
+    while (node != end) {
+      node_t* next = node->next;
 
-  if (steal_node(source, dest, node) == -1) {
-    return -1;
+      if (steal_node(source, dest, node, UNKNOWN_POSITION) == -1) {
+        return -1;
+      }
+
+      node = next;
+    }
+
+    return 0;
   }
 
-  return 0;
-}
+  node_t* before = first->prev;
 
-/**
- * @brief Sorts nodes in a linked list by a given comparator.
- * 
- * @param list The linked list to sort.
- * @param compare The comparator to use.
- * @return 0 on success, -1 on failure.
- */
-int linked_list_sort(linked_list_t *list, compare_func_t compare) {
-  assert(list);
-  assert(compare);
+  detach_chain(source, first, last, count);
 
-  if (list->size <= 1) {
+  if (dest->positions != NULL) {
+    node_positions_invalidate(dest->positions);
+  }
+
+  if (attach_chain(dest, first, last, count) == 0) {
     return 0;
   }
 
-  if (quick_sort(list, list->head, list->tail, compare) == -1) {
-    return -1;
+  // Put the run back where it was so no nodes are lost.
+  node_t* after = before != NULL ? before->next : source->head;
+
+  first->prev = before;
+  last->next = after;
+
+  if (before != NULL) {
+    before->next = first;
+  } else {
+    source->head = first;
+  }
+
+  if (after != NULL) {
+    after->prev = last;
+  } else {
+    source->tail = last;
+  }
+
+  source->size += count;
+
+  if (source->positions != NULL) {
+    node_positions_invalidate(source->positions);
+  }
+
+  // The index keeps its capacity when nodes are removed, so putting the run back doesn't
+  // grow it. Should that fail anyway, the index is rebuilt rather than left incomplete.
+  if (source->index != NULL) {
+    node_t* node = first;
+
+    for (size_t i = 0; i < count; i++, node = node->next) {
+      if (node_index_insert(source->index, node) == 0) {
+        continue;
+      }
+
+      linked_list_disable_index(source);
+
+      if (linked_list_enable_index(source) == -1) {
+        // Without an index the list still works, lookups fall back to a linear search.
+        return -1;
+      }
+
+      break;
+    }
   }
 
-  return 0;  
+  return -1;
 }
 
 /**
- * @brief Clears a linked list.
+ * @brief Module internal function to check whether nodes can be relinked between two lists.
  * 
- * @param list The linked list to clear.
- *
- * @return 0 on success, -1 on failure.
+ * @param source The linked list nodes are taken from.
+ * @param dest The linked list nodes are given to.
+ * @return true if nodes can move without being copied, false otherwise.
  */
-int linked_list_clear(linked_list_t *list) {
+bool shares_nodes(const linked_list_t* source, const linked_list_t* dest) {
+  assert(source);
+  assert(dest);
+
+  return source->pool == dest->pool && source->elem_size == dest->elem_size;
+}
+
+/**
+ * @brief Module internal function to find a node holding the given data.
+ * 
+ * @param list The linked list to search.
+ * @param data The data to find.
+ * @return The node holding the data or NULL if there is none.
+ */
+node_t* find_node(linked_list_t* list, void* data) {
   assert(list);
 
-  node_t* node = list->head;
+  if (list->index != NULL) {
+    return node_index_find(list->index, data);
+  }
 
-  while (node != NULL) {
-    node_t* next = node->next;
-    free(node);
-    node = next;
+  if (list->elem_size != 0) {
+    for (node_t* node = list->head; node != NULL; node = node->next) {
+      if (memcmp(node->data, data, list->elem_size) == 0) {
+        return node;
+      }
+    }
+
+    return NULL;
   }
 
-  list->head = NULL;
-  list->tail = NULL;
-  list->size = 0;
+  for (node_t* node = list->head; node != NULL; node = node->next) {
+    if (node->data == data) {
+      return node;
+    }
+  }
 
-  return 0;
+  return NULL;
 }
 
 /**
@@ -309,10 +1870,24 @@ node_t* node_at(linked_list_t* list, size_t index) {
   assert(list);
   assert(index < list->size);
 
-  node_t* node = list->head;
+  node_t* node = NULL;
+
+  if (list->positions != NULL && (node = node_positions_at(list->positions, list, index)) != NULL) {
+    return node;
+  }
 
-  for (size_t i = 0; i < index; i++) {
-    node = node->next;
+  if (index < list->size / 2) {
+    node = list->head;
+
+    for (size_t i = 0; i < index; i++) {
+      node = node->next;
+    }
+  } else {
+    node = list->tail;
+
+    for (size_t i = list->size - 1; i > index; i--) {
+      node = node->prev;
+    }
   }
 
   return node;
@@ -329,6 +1904,16 @@ int attach_node(linked_list_t* list, node_t* node) {
   assert(list);
   assert(node);
 
+  if (list->index != NULL && node_index_insert(list->index, node) == -1) {
+    return -1;
+  }
+
+  if (list->positions != NULL && node_positions_append(list->positions, node) == -1) {
+    node_positions_invalidate(list->positions);
+  }
+
+  comparator_mark_sorted(list, NULL);
+
   if (list->size == 0) {
     list->head = node;
     list->tail = node;
@@ -352,12 +1937,31 @@ int attach_node(linked_list_t* list, node_t* node) {
  * 
  * @param list The linked list to detach the node from.
  * @param node The node to detach.
+ * @param position The position of the node if known, otherwise UNKNOWN_POSITION.
  * @return 0 on success, -1 on failure.
  */
-int detach_node(linked_list_t* list, node_t* node) {
+int detach_node(linked_list_t* list, node_t* node, size_t position) {
   assert(list);
   assert(node);
 
+  if (list->index != NULL && node_index_remove(list->index, node) == -1) {
+    return -1;
+  }
+
+  if (list->positions != NULL) {
+    if (position == UNKNOWN_POSITION && node == list->head) {
+      position = 0;
+    } else if (position == UNKNOWN_POSITION && node == list->tail) {
+      position = list->size - 1;
+    }
+
+    if (position == UNKNOWN_POSITION || node_positions_stale(list->positions)) {
+      node_positions_invalidate(list->positions);
+    } else if (node_positions_remove_at(list->positions, list, position) != node) {
+      node_positions_invalidate(list->positions);
+    }
+  }
+
   if (node->prev != NULL) {
     node->prev->next = node->next;
   } else {
@@ -384,17 +1988,46 @@ int detach_node(linked_list_t* list, node_t* node) {
  * @param source The source linked list.
  * @param dest The destination linked list.
  * @param node The node to move.
+ * @param position The position of the node in the source if known, otherwise UNKNOWN_POSITION.
  * @return 0 on success, -1 on failure.
  */
-int steal_node(linked_list_t* source, linked_list_t* dest, node_t* node) {
+int steal_node(linked_list_t* source, linked_list_t* dest, node_t* node, size_t position) {
   assert(source);
   assert(dest);
 
-  if (detach_node(source, node) == -1) {
+  if (shares_nodes(source, dest)) {
+    if (detach_node(source, node, position) == -1) {
+      return -1;
+    }
+
+    return attach_node(dest, node);
+  }
+
+  // An element can't be copied into a node of a different size, nor outlive its node.
+  if (source->elem_size != dest->elem_size) {
+    return -1;
+  }
+
+  // Nodes never leave the pool that owns them so they're copied across instead.
+  node_t* copy = NULL;
+
+  if ((copy = alloc_node(dest)) == NULL) {
+    return -1;
+  }
+
+  set_data(dest, copy, node->data);
+
+  if (detach_node(source, node, position) == -1) {
+    release_node(dest, copy);
+
     return -1;
   }
 
-  if (attach_node(dest, node) == -1) {
+  release_node(source, node);
+
+  if (attach_node(dest, copy) == -1) {
+    release_node(dest, copy);
+
     return -1;
   }
 
@@ -402,130 +2035,267 @@ int steal_node(linked_list_t* source, linked_list_t* dest, node_t* node) {
 }
 
 /**
- * @brief Module internal function to sort a linked list using quick sort.
+ * @brief Module internal function to insert data in front of a node, or at the end.
  * 
- * @param list The linked list to sort.
- * @param start The start node of the partition of the linked list.
- * @param end The end node of the partition of the linked list.
- * @param compare The comparator to use.
+ * @param list The linked list to insert into.
+ * @param next The node to insert in front of, or NULL to insert at the end.
+ * @param data The data to insert.
+ * @param position The position of next if known, otherwise UNKNOWN_POSITION.
  * @return 0 on success, -1 on failure.
  */
-int quick_sort(linked_list_t* list, node_t* start, node_t* end, compare_func_t compare) {
+int insert_before(linked_list_t* list, node_t* next, void* data, size_t position) {
   assert(list);
-  assert(start);
-  assert(end);
-  assert(compare);
-  
-  node_t* new_start= NULL;
-  node_t* new_end = NULL;
+  assert(data);
 
-  node_t* pivot = partition(list, start, end, &new_start, &new_end, compare);
-  
-  if (pivot == NULL) {
+  if (next == NULL) {
+    return linked_list_insert(list, data);
+  }
+
+  node_t* node = NULL;
+
+  if ((node = alloc_node(list)) == NULL) {
     return -1;
   }
 
-  if (pivot != new_start) {
-    if (quick_sort(list, new_start, pivot->prev, compare) == -1) {
-      return -1;
+  set_data(list, node, data);
+
+  if (list->index != NULL && node_index_insert(list->index, node) == -1) {
+    release_node(list, node);
+
+    return -1;
+  }
+
+  if (list->positions != NULL) {
+    if (position == UNKNOWN_POSITION || node_positions_insert_at(list->positions, list, position, node) == -1) {
+      node_positions_invalidate(list->positions);
     }
   }
 
-  if (pivot != new_end) {
-    if (quick_sort(list, pivot->next, new_end, compare) == -1) {
+  return link_before(list, next, node);
+}
+
+/**
+ * @brief Module internal function to insert data after a node.
+ * 
+ * @param list The linked list to insert into.
+ * @param after The node to insert after.
+ * @param data The data to insert.
+ * @param position The position of after if known, otherwise UNKNOWN_POSITION.
+ * @return 0 on success, -1 on failure.
+ */
+int insert_after(linked_list_t* list, node_t* after, void* data, size_t position) {
+  assert(list);
+  assert(after);
+
+  return insert_before(list, after->next, data, position == UNKNOWN_POSITION ? UNKNOWN_POSITION : position + 1);
+}
+
+/**
+ * @brief Module internal function to add a detached node to a batch of nodes to release.
+ * 
+ * @param node The detached node.
+ * @param first The first node of the batch, updated.
+ * @param last The last node of the batch, updated.
+ */
+void collect_node(node_t* node, node_t** first, node_t** last) {
+  assert(node);
+  assert(first);
+  assert(last);
+
+  node->next = *first;
+  *first = node;
+
+  if (*last == NULL) {
+    *last = node;
+  }
+}
+
+/**
+ * @brief Module internal function to release a batch of detached nodes linked through next.
+ *
+ * The batch goes to the list's reclaimer in one step when it has one.
+ * 
+ * @param list The linked list the nodes were allocated for.
+ * @param first The first node of the batch, or NULL if it is empty.
+ * @param last The last node of the batch.
+ */
+void release_batch(linked_list_t* list, node_t* first, node_t* last) {
+  assert(list);
+
+  if (first == NULL) {
+    return;
+  }
+
+  if (list->pool == NULL && list->reclaimer != NULL) {
+    node_reclaimer_submit(list->reclaimer, first, last);
+
+    return;
+  }
+
+  release_chain(list, first);
+}
+
+/**
+ * @brief Module internal function to detach a node, release it and return its data.
+ * 
+ * @param list The linked list to remove from.
+ * @param node The node to remove, or NULL if the list is empty.
+ * @param position The position of the node.
+ * @return The data of the node or NULL on failure.
+ */
+void* pop_node(linked_list_t* list, node_t* node, size_t position) {
+  assert(list);
+
+  if (node == NULL || list->elem_size != 0) {
+    return NULL;
+  }
+
+  void* data = node->data;
+
+  if (detach_node(list, node, position) == -1) {
+    return NULL;
+  }
+
+  release_node(list, node);
+
+  return data;
+}
+
+/**
+ * @brief Module internal function to insert data into a linked list kept sorted by a comparator.
+ * 
+ * @param list The linked list to insert into.
+ * @param data The data to insert.
+ * @param comparator The comparator the list is sorted by.
+ * @return 0 on success, -1 on failure.
+ */
+int insert_sorted(linked_list_t* list, void* data, const comparator_t* comparator) {
+  assert(list);
+  assert(data);
+  assert(comparator);
+
+  if (!comparator_sorted(list, comparator)) {
+    int sorted = comparator->compare != NULL
+      ? linked_list_sort(list, comparator->compare)
+      : linked_list_sort_r(list, comparator->compare_r, comparator->ctx);
+
+    if (sorted == -1) {
       return -1;
     }
   }
 
+  size_t position = UNKNOWN_POSITION;
+  node_t* next = sorted_successor(list, data, comparator, &position);
+
+  if (insert_before(list, next, data, position) == -1) {
+    return -1;
+  }
+
+  comparator_mark_sorted(list, comparator);
+
   return 0;
 }
 
 /**
- * @brief Module internal function to partition a segment of a linked list during quick sort.
+ * @brief Module internal function to find the first node of a sorted list comparing greater than data.
  * 
- * @param list The linked list to partition.
- * @param start The start of the segment to partition.
- * @param end The end of the segment to partition.
- * @param new_start Out parameter containing the new start of the segment.
- * @param new_end Out parameter containing the new end of the segment.
- * @param compare The compare function to use. 
- * @return The pivot node.
+ * @param list The sorted linked list to search.
+ * @param data The data to compare against.
+ * @param comparator The comparator the list is sorted by.
+ * @param position Set to the position of the node found, or UNKNOWN_POSITION.
+ * @return The node found or NULL if data sorts at the end.
  */
-node_t* partition(linked_list_t* list, node_t* start, node_t* end, node_t** new_start, node_t** new_end, compare_func_t compare) {
+node_t* sorted_successor(linked_list_t* list, void* data, const comparator_t* comparator, size_t* position) {
   assert(list);
-  assert(start);
-  assert(end);
-  assert(compare);
+  assert(data);
+  assert(comparator);
+  assert(position);
 
-  if (start == end) {
-    *new_start = start;
-    *new_end = start;
+  *position = UNKNOWN_POSITION;
 
-    return start;
-  }
+  if (list->tail == NULL || comparator_compare(comparator, list->tail->data, data) <= 0) {
+    *position = list->size;
 
-  node_t* pivot = end;
-  node_t* current = start;
+    return NULL;
+  }
 
-  while (current != pivot) {
-    node_t* next = current->next;
+  if (comparator_compare(comparator, list->head->data, data) > 0) {
+    *position = 0;
 
-    if (compare(current->data, pivot->data) > 0) {
-      if (detach_node(list, current) == -1) {
-        return NULL;
-      }
+    return list->head;
+  }
 
-      if (insert_after(list, pivot, current) == -1) {
-        return NULL;
-      }
+  // Searching the middle is logarithmic with positions, so they are enabled on first need.
+  // Should that fail the search walks back from the tail instead.
+  if (linked_list_enable_positions(list) == 0) {
+    node_t* node = NULL;
 
-      if (*new_end == NULL) {
-        *new_end = current;
-      }    
-    } else {
-      if (*new_start == NULL) {
-        *new_start = current;
-      }
+    if (node_positions_upper_bound(list->positions, list, comparator, data, &node, position) == 0) {
+      return node;
     }
+  }
 
-    current = next;
+  node_t* node = list->tail;
+
+  while (comparator_compare(comparator, node->prev->data, data) > 0) {
+    node = node->prev;
   }
 
-  if (*new_start == NULL) {
-    *new_start = pivot;
+  return node;
+}
+
+/**
+ * @brief Module internal function to get the position of a cursor's node for the positional index.
+ *
+ * The position a cursor tracks goes wrong if its list is changed other than through it,
+ * so it is checked against a fresh index and otherwise reported as unknown.
+ * 
+ * @param cursor The cursor, on a node.
+ * @return The position of the node or UNKNOWN_POSITION.
+ */
+size_t cursor_position(const linked_list_cursor_t* cursor) {
+  assert(cursor);
+
+  linked_list_t* list = cursor->list;
+
+  if (list->positions == NULL || node_positions_stale(list->positions) || cursor->position >= list->size) {
+    return UNKNOWN_POSITION;
   }
 
-  if (*new_end == NULL) {
-    *new_end = pivot;
+  if (node_positions_at(list->positions, list, cursor->position) != cursor->node) {
+    return UNKNOWN_POSITION;
   }
 
-  return pivot;
+  return cursor->position;
 }
 
 /**
- * @brief Module internal function to insert a node after a given node.
+ * @brief Module internal function to link an unattached node in front of another.
+ *
+ * Indexes are expected to have been updated by the caller.
  * 
- * @param list The linked list to insert the node into.
- * @param after The node to insert after. 
- * @param node  The node to insert. 
+ * @param list The linked list to link the node into.
+ * @param next The node to link in front of.
+ * @param node The node to link.
  * @return 0 on success, -1 on failure.
- */ 
-int insert_after(linked_list_t* list, node_t* after, node_t* node) {
+ */
+int link_before(linked_list_t* list, node_t* next, node_t* node) {
   assert(list);
-  assert(after);
+  assert(next);
   assert(node);
-  assert(node->prev == NULL);
-  assert(node->next == NULL);
 
-  if (after->next == NULL) {
-    return attach_node(list, node);
-  }
+  comparator_mark_sorted(list, NULL);
 
-  node->next = after->next;
-  node->prev = after;
+  node->prev = next->prev;
+  node->next = next;
+
+  if (next->prev != NULL) {
+    next->prev->next = node;
+  } else {
+    list->head = node;
+  }
 
-  after->next = node;
-  node->next->prev = node;
+  next->prev = node;
 
   list->size++;
 
@@ -0,0 +1,1178 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scds/linked_list.h"
+#include "comparator.h"
+#include "node_positions.h"
+
+#ifndef PARALLEL_SORT_MIN_CHUNK
+#define PARALLEL_SORT_MIN_CHUNK 8192
+#endif
+#define INTROSORT_MIN_PARTITION 16
+
+/**
+ * Represents a node paired with an extracted radix sort key, kept to 16 bytes so each
+ * scatter pass moves as little memory as possible.
+ */
+typedef struct key_pair {
+  uint64_t key;
+  node_t* node;
+} key_pair_t;
+
+/**
+ * Represents a node paired with its data and an extracted sort key, kept contiguous so
+ * sorting doesn't chase node pointers.
+ */
+typedef struct keyed_node {
+  uint64_t key;
+  node_t* node;
+  void* data;
+} keyed_node_t;
+
+/**
+ * Represents the order keyed nodes are sorted in, by key prefix first when prefixed.
+ */
+typedef struct keyed_order {
+  const comparator_t* comparator;
+  bool prefixed;
+} keyed_order_t;
+
+/**
+ * Represents a unit of work for a parallel sort thread, sorting head or merging it with other.
+ */
+typedef struct sort_task {
+  node_t* head;
+  node_t* other;
+  const comparator_t* comparator;
+} sort_task_t;
+
+static int sort_list_step(linked_list_t* list, linked_list_step_t* step, const comparator_t* comparator, size_t budget);
+static int mark_sorted(linked_list_t* list, const comparator_t* comparator, int result);
+static int sort_list(linked_list_t* list, const comparator_t* comparator);
+static int sort_list_parallel(linked_list_t* list, const comparator_t* comparator, size_t threads);
+static int sort_list_by_key(linked_list_t* list, key_func_t key, key_r_func_t key_r, void* ctx);
+static int sort_list_cached(linked_list_t* list, const comparator_t* comparator, key_func_t prefix, key_r_func_t prefix_r);
+static node_t* sort_chain(node_t* head, const comparator_t* comparator);
+static node_t* take_run(node_t** remaining, node_t** tail, const comparator_t* comparator);
+static node_t* merge_runs(node_t* left, node_t* right, node_t** tail, const comparator_t* comparator);
+static void relink(linked_list_t* list);
+static void move_before(linked_list_t* list, node_t* node, node_t* next);
+static void relink_from(linked_list_t* list, const keyed_node_t* order, size_t count);
+static void relink_pairs(linked_list_t* list, const key_pair_t* order, size_t count);
+static void link_in_order(node_t* node, node_t** prev);
+static void finish_relink(linked_list_t* list, node_t* first, node_t* last);
+static void introsort(keyed_node_t* nodes, size_t count, size_t depth, const keyed_order_t* order);
+static size_t partition(keyed_node_t* nodes, size_t count, const keyed_order_t* order);
+static void heap_sort(keyed_node_t* nodes, size_t count, const keyed_order_t* order);
+static void sift_down(keyed_node_t* nodes, size_t root, size_t count, const keyed_order_t* order);
+static void insertion_sort(keyed_node_t* nodes, size_t count, const keyed_order_t* order);
+static int compare_keyed(const keyed_node_t* a, const keyed_node_t* b, const keyed_order_t* order);
+static void swap_keyed(keyed_node_t* a, keyed_node_t* b);
+static void run_tasks(sort_task_t* tasks, size_t count, void* (*work)(void*));
+static void* sort_work(void* task);
+static void* merge_work(void* task);
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator.
+ *
+ * Uses a stable, non-recursive natural merge sort. The list is always sorted, as the data
+ * may have changed since it last was, and is then known to be sorted by the comparator for
+ * linked_list_insert_sorted until changed, see linked_list_mark_unsorted.
+ * 
+ * @param list The linked list to sort.
+ * @param compare The comparator to use.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort(linked_list_t *list, compare_func_t compare) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return mark_sorted(list, &comparator, sort_list(list, &comparator));
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator taking a user context.
+ *
+ * Behaves as linked_list_sort, passing ctx to every comparison. The list is then known to
+ * be sorted by the comparator and context for linked_list_insert_sorted_r.
+ * 
+ * @param list The linked list to sort.
+ * @param compare The comparator to use.
+ * @param ctx The context passed to the comparator.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_r(linked_list_t *list, compare_r_func_t compare, void *ctx) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return mark_sorted(list, &comparator, sort_list(list, &comparator));
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator using several threads.
+ *
+ * The list is cut into one chunk per thread, the chunks are sorted concurrently and then
+ * merged pairwise, each round of merges also running concurrently. Nodes are relinked in
+ * place and the result is stable. Lists too small to benefit are sorted on the calling
+ * thread. The comparator must be safe to call from several threads at once.
+ * 
+ * @param list The linked list to sort.
+ * @param compare The comparator to use.
+ * @param threads The maximum number of threads to use, including the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_parallel(linked_list_t *list, compare_func_t compare, size_t threads) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return mark_sorted(list, &comparator, sort_list_parallel(list, &comparator, threads));
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator taking a user context using several threads.
+ *
+ * Behaves as linked_list_sort_parallel, passing ctx to every comparison. The comparator
+ * may be called with the same context from several threads at once.
+ * 
+ * @param list The linked list to sort.
+ * @param compare The comparator to use.
+ * @param ctx The context passed to the comparator.
+ * @param threads The maximum number of threads to use, including the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_parallel_r(linked_list_t *list, compare_r_func_t compare, void *ctx, size_t threads) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return mark_sorted(list, &comparator, sort_list_parallel(list, &comparator, threads));
+}
+
+/**
+ * @brief Sorts nodes in a linked list in ascending order of an unsigned integer key.
+ *
+ * Each key is extracted once and (key, node) pairs are sorted with a stable LSD radix
+ * sort a byte at a time, skipping bytes every key shares, before the list is relinked
+ * in a single pass.
+ * 
+ * @param list The linked list to sort.
+ * @param key The function extracting the key from the data.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_by_key(linked_list_t *list, key_func_t key) {
+  assert(list);
+  assert(key);
+
+  return mark_sorted(list, NULL, sort_list_by_key(list, key, NULL, NULL));
+}
+
+/**
+ * @brief Sorts nodes in a linked list in ascending order of an unsigned integer key extracted with a user context.
+ *
+ * Behaves as linked_list_sort_by_key, passing ctx to every key extraction.
+ * 
+ * @param list The linked list to sort.
+ * @param key The function extracting the key from the data.
+ * @param ctx The context passed to the key function.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_by_key_r(linked_list_t *list, key_r_func_t key, void *ctx) {
+  assert(list);
+  assert(key);
+
+  return mark_sorted(list, NULL, sort_list_by_key(list, NULL, key, ctx));
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator through a contiguous array.
+ *
+ * Each node's data, and optionally a key prefix, is copied into an array that is sorted
+ * with an introsort before the list is relinked in a single pass, so comparisons touch
+ * the array rather than the nodes. When given, prefix must agree with the comparator:
+ * a smaller prefix must mean the data compares less. The comparator is only called for
+ * data with equal prefixes. The sort is not stable.
+ * 
+ * @param list The linked list to sort.
+ * @param compare The comparator to use.
+ * @param prefix The function extracting a key prefix from the data, or NULL for none.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_cached(linked_list_t *list, compare_func_t compare, key_func_t prefix) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return mark_sorted(list, &comparator, sort_list_cached(list, &comparator, prefix, NULL));
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator taking a user context through a contiguous array.
+ *
+ * Behaves as linked_list_sort_cached, passing ctx to every comparison and prefix extraction.
+ * 
+ * @param list The linked list to sort.
+ * @param compare The comparator to use.
+ * @param ctx The context passed to the comparator and prefix function.
+ * @param prefix The function extracting a key prefix from the data, or NULL for none.
+ * @return 0 on success, -1 on failure.
+ */
+int linked_list_sort_cached_r(linked_list_t *list, compare_r_func_t compare, void *ctx, key_r_func_t prefix) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return mark_sorted(list, &comparator, sort_list_cached(list, &comparator, NULL, prefix));
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator, a budget of steps at a time.
+ *
+ * Uses a stable bottom-up merge sort that merges adjacent runs in place by moving single
+ * nodes, so the list holds every node in a consistent order between calls. Each step scans,
+ * compares or moves at most one node and sorting takes O(n log n) steps overall. The list
+ * must not be changed between calls.
+ * 
+ * @param list The linked list to sort.
+ * @param step The step tracking progress, done once the list is sorted.
+ * @param compare The comparator to use.
+ * @param budget The maximum number of steps to take.
+ * @return 0 on success, -1 on failure or if the list was changed between calls.
+ */
+int linked_list_sort_step(linked_list_t *list, linked_list_step_t *step, compare_func_t compare, size_t budget) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return sort_list_step(list, step, &comparator, budget);
+}
+
+/**
+ * @brief Sorts nodes in a linked list by a given comparator taking a user context, a budget of steps at a time.
+ *
+ * Behaves as linked_list_sort_step, passing ctx to every comparison.
+ * 
+ * @param list The linked list to sort.
+ * @param step The step tracking progress, done once the list is sorted.
+ * @param compare The comparator to use.
+ * @param ctx The context passed to the comparator.
+ * @param budget The maximum number of steps to take.
+ * @return 0 on success, -1 on failure or if the list was changed between calls.
+ */
+int linked_list_sort_step_r(linked_list_t *list, linked_list_step_t *step, compare_r_func_t compare, void *ctx, size_t budget) {
+  assert(list);
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return sort_list_step(list, step, &comparator, budget);
+}
+
+/**
+ * @brief Module internal function to sort a linked list by in place merges, a budget of steps at a time.
+ * 
+ * @param list The linked list to sort.
+ * @param step The step tracking progress, done once the list is sorted.
+ * @param comparator The comparator to use.
+ * @param budget The maximum number of steps to take.
+ * @return 0 on success, -1 on failure or if the list was changed between calls.
+ */
+int sort_list_step(linked_list_t* list, linked_list_step_t* step, const comparator_t* comparator, size_t budget) {
+  assert(list);
+  assert(step);
+  assert(comparator);
+  assert(budget > 0);
+
+  if (!step->started) {
+    step->started = true;
+    step->size = list->size;
+
+    if (list->size <= 1) {
+      step->done = true;
+
+      return mark_sorted(list, comparator, 0);
+    }
+
+    comparator_mark_sorted(list, NULL);
+
+    if (list->positions != NULL) {
+      node_positions_invalidate(list->positions);
+    }
+
+    step->width = 1;
+    step->node = list->head;
+    step->other = list->head;
+    step->left = 0;
+    step->merging = false;
+  }
+
+  if (step->done) {
+    return 0;
+  }
+
+  if (list->size != step->size) {
+    return -1;
+  }
+
+  for (size_t taken = 0; taken < budget; taken++) {
+    if (!step->merging) {
+      // Scanning the left run, the right run starts once width nodes are passed.
+      if (step->node == NULL || step->other == NULL) {
+        if (step->width >= step->size - step->width) {
+          step->done = true;
+
+          return mark_sorted(list, comparator, 0);
+        }
+
+        step->width *= 2;
+        step->node = list->head;
+        step->other = list->head;
+        step->left = 0;
+
+        continue;
+      }
+
+      step->other = step->other->next;
+      step->left++;
+
+      if (step->left == step->width && step->other != NULL) {
+        step->right = step->width;
+        step->merging = true;
+      }
+
+      continue;
+    }
+
+    node_t* left = step->node;
+    node_t* right = step->other;
+
+    if (step->right == 0 || right == NULL) {
+      step->node = right;
+      step->left = 0;
+      step->merging = false;
+    } else if (step->left == 0) {
+      step->other = right->next;
+      step->right--;
+    } else if (comparator_compare(comparator, right->data, left->data) < 0) {
+      step->other = right->next;
+      step->right--;
+
+      move_before(list, right, left);
+    } else {
+      step->node = left->next;
+      step->left--;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to record the comparator a linked list is sorted by after a sort.
+ * 
+ * @param list The linked list sorted.
+ * @param comparator The comparator the list is now sorted by, or NULL if not sorted by a comparator.
+ * @param result The result of the sort.
+ * @return The result of the sort.
+ */
+int mark_sorted(linked_list_t* list, const comparator_t* comparator, int result) {
+  assert(list);
+
+  if (result == 0) {
+    comparator_mark_sorted(list, comparator);
+  }
+
+  return result;
+}
+
+/**
+ * @brief Module internal function to sort nodes in a linked list using a stable natural merge sort.
+ * 
+ * @param list The linked list to sort.
+ * @param comparator The comparator to use.
+ * @return 0 on success, -1 on failure.
+ */
+int sort_list(linked_list_t* list, const comparator_t* comparator) {
+  assert(list);
+  assert(comparator);
+
+  if (list->size <= 1) {
+    return 0;
+  }
+
+  list->head = sort_chain(list->head, comparator);
+
+  relink(list);
+
+  return 0;  
+}
+
+/**
+ * @brief Module internal function to sort nodes in a linked list using several threads.
+ * 
+ * @param list The linked list to sort.
+ * @param comparator The comparator to use.
+ * @param threads The maximum number of threads to use, including the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int sort_list_parallel(linked_list_t* list, const comparator_t* comparator, size_t threads) {
+  assert(list);
+  assert(comparator);
+
+  if (threads > list->size / PARALLEL_SORT_MIN_CHUNK) {
+    threads = list->size / PARALLEL_SORT_MIN_CHUNK;
+  }
+
+  if (threads <= 1) {
+    return sort_list(list, comparator);
+  }
+
+  sort_task_t* tasks = NULL;
+
+  if ((tasks = malloc(threads * sizeof(sort_task_t))) == NULL) {
+    return sort_list(list, comparator);
+  }
+
+  // The first size % threads chunks take one extra node so that none is left empty.
+  size_t chunk = list->size / threads;
+  size_t larger = list->size % threads;
+  node_t* node = list->head;
+
+  for (size_t i = 0; i < threads; i++) {
+    size_t length = i < larger ? chunk + 1 : chunk;
+
+    tasks[i].head = node;
+    tasks[i].other = NULL;
+    tasks[i].comparator = comparator;
+
+    for (size_t j = 1; j < length; j++) {
+      node = node->next;
+    }
+
+    node_t* next = node->next;
+    node->next = NULL;
+    node = next;
+  }
+
+  run_tasks(tasks, threads, sort_work);
+
+  size_t runs = threads;
+
+  while (runs > 1) {
+    size_t pairs = runs / 2;
+
+    for (size_t i = 0; i < pairs; i++) {
+      tasks[i].head = tasks[i * 2].head;
+      tasks[i].other = tasks[i * 2 + 1].head;
+    }
+
+    run_tasks(tasks, pairs, merge_work);
+
+    if (runs % 2 != 0) {
+      tasks[pairs].head = tasks[runs - 1].head;
+    }
+
+    runs = (runs + 1) / 2;
+  }
+
+  list->head = tasks[0].head;
+
+  free(tasks);
+
+  relink(list);
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to sort nodes in a linked list by an integer key using a radix sort.
+ * 
+ * @param list The linked list to sort.
+ * @param key The function extracting the key from the data, or NULL to use key_r.
+ * @param key_r The function extracting the key from the data with a context.
+ * @param ctx The context passed to key_r.
+ * @return 0 on success, -1 on failure.
+ */
+int sort_list_by_key(linked_list_t* list, key_func_t key, key_r_func_t key_r, void* ctx) {
+  assert(list);
+  assert(key || key_r);
+
+  if (list->size <= 1) {
+    return 0;
+  }
+
+  size_t count = list->size;
+  key_pair_t* from = NULL;
+  size_t histogram[sizeof(uint64_t)][256] = { { 0 } };
+
+  if ((from = malloc(count * 2 * sizeof(key_pair_t))) == NULL) {
+    return -1;
+  }
+
+  key_pair_t* buffer = from;
+  key_pair_t* to = from + count;
+  size_t i = 0;
+
+  for (node_t* node = list->head; node != NULL; node = node->next, i++) {
+    from[i].key = key != NULL ? key(node->data) : key_r(node->data, ctx);
+    from[i].node = node;
+
+    for (size_t byte = 0; byte < sizeof(uint64_t); byte++) {
+      histogram[byte][(from[i].key >> (byte * 8)) & 0xff]++;
+    }
+  }
+
+  for (size_t byte = 0; byte < sizeof(uint64_t); byte++) {
+    size_t* buckets = histogram[byte];
+
+    if (buckets[(from[0].key >> (byte * 8)) & 0xff] == count) {
+      continue;
+    }
+
+    size_t offset = 0;
+
+    for (size_t bucket = 0; bucket < 256; bucket++) {
+      size_t size = buckets[bucket];
+      buckets[bucket] = offset;
+      offset += size;
+    }
+
+    for (i = 0; i < count; i++) {
+      to[buckets[(from[i].key >> (byte * 8)) & 0xff]++] = from[i];
+    }
+
+    key_pair_t* swap = from;
+    from = to;
+    to = swap;
+  }
+
+  relink_pairs(list, from, count);
+
+  free(buffer);
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to sort nodes in a linked list through a contiguous array using an introsort.
+ * 
+ * @param list The linked list to sort.
+ * @param comparator The comparator to use.
+ * @param prefix The function extracting a key prefix from the data, or NULL.
+ * @param prefix_r The function extracting a key prefix from the data with the comparator's context, or NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int sort_list_cached(linked_list_t* list, const comparator_t* comparator, key_func_t prefix, key_r_func_t prefix_r) {
+  assert(list);
+  assert(comparator);
+
+  if (list->size <= 1) {
+    return 0;
+  }
+
+  size_t count = list->size;
+  keyed_node_t* nodes = NULL;
+
+  if ((nodes = malloc(count * sizeof(keyed_node_t))) == NULL) {
+    return -1;
+  }
+
+  size_t i = 0;
+
+  for (node_t* node = list->head; node != NULL; node = node->next, i++) {
+    if (prefix != NULL) {
+      nodes[i].key = prefix(node->data);
+    } else if (prefix_r != NULL) {
+      nodes[i].key = prefix_r(node->data, comparator->ctx);
+    } else {
+      nodes[i].key = 0;
+    }
+
+    nodes[i].node = node;
+    nodes[i].data = node->data;
+  }
+
+  keyed_order_t order = { comparator, prefix != NULL || prefix_r != NULL };
+  size_t depth = 0;
+
+  for (size_t n = count; n > 1; n >>= 1) {
+    depth += 2;
+  }
+
+  introsort(nodes, count, depth, &order);
+
+  relink_from(list, nodes, count);
+
+  free(nodes);
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to sort a chain linked through next using a bottom-up natural merge sort.
+ *
+ * Each pass splits the chain into its existing runs, reversing strictly descending ones,
+ * and merges them pairwise until a single run remains. Only next is maintained.
+ * 
+ * @param head The first node of the chain.
+ * @param comparator The comparator to use.
+ * @return The first node of the sorted chain.
+ */
+node_t* sort_chain(node_t* head, const comparator_t* comparator) {
+  assert(comparator);
+
+  size_t runs = 0;
+
+  do {
+    node_t* remaining = head;
+    node_t* tail = NULL;
+
+    runs = 0;
+
+    while (remaining != NULL) {
+      node_t* run_tail = NULL;
+      node_t* run = take_run(&remaining, &run_tail, comparator);
+
+      runs++;
+
+      if (remaining != NULL) {
+        node_t* other_tail = NULL;
+        node_t* other = take_run(&remaining, &other_tail, comparator);
+
+        runs++;
+
+        run = merge_runs(run, other, &run_tail, comparator);
+      }
+
+      if (tail == NULL) {
+        head = run;
+      } else {
+        tail->next = run;
+      }
+
+      tail = run_tail;
+    }
+  } while (runs > 2);
+
+  return head;
+}
+/**
+ * @brief Module internal function to detach the next ascending run from a chain.
+ *
+ * A strictly descending run is reversed as it is taken, which keeps the sort stable.
+ * 
+ * @param remaining In out parameter holding the chain, advanced past the run.
+ * @param tail Out parameter containing the last node of the run.
+ * @param comparator The comparator to use.
+ * @return The first node of the run.
+ */
+node_t* take_run(node_t** remaining, node_t** tail, const comparator_t* comparator) {
+  assert(remaining);
+  assert(*remaining);
+  assert(tail);
+  assert(comparator);
+
+  node_t* head = *remaining;
+  node_t* current = head;
+  node_t* next = current->next;
+
+  if (next != NULL && comparator_compare(comparator, current->data, next->data) > 0) {
+    current->next = NULL;
+
+    while (next != NULL && comparator_compare(comparator, current->data, next->data) > 0) {
+      node_t* after = next->next;
+
+      next->next = current;
+      current = next;
+      next = after;
+    }
+
+    *remaining = next;
+    *tail = head;
+
+    return current;
+  }
+
+  while (next != NULL && comparator_compare(comparator, current->data, next->data) <= 0) {
+    current = next;
+    next = current->next;
+  }
+
+  current->next = NULL;
+
+  *remaining = next;
+  *tail = current;
+
+  return head;
+}
+
+/**
+ * @brief Module internal function to stably merge two runs linked through next.
+ * 
+ * @param left The run that comes first in the list.
+ * @param right The run that comes second in the list.
+ * @param tail Out parameter containing the last node of the merged run.
+ * @param comparator The comparator to use.
+ * @return The first node of the merged run.
+ */
+node_t* merge_runs(node_t* left, node_t* right, node_t** tail, const comparator_t* comparator) {
+  assert(left);
+  assert(right);
+  assert(tail);
+  assert(comparator);
+
+  node_t head;
+  node_t* last = &head;
+
+  while (left != NULL && right != NULL) {
+    if (comparator_compare(comparator, left->data, right->data) <= 0) {
+      last->next = left;
+      left = left->next;
+    } else {
+      last->next = right;
+      right = right->next;
+    }
+
+    last = last->next;
+  }
+
+  last->next = left != NULL ? left : right;
+
+  while (last->next != NULL) {
+    last = last->next;
+  }
+
+  *tail = last;
+
+  return head.next;
+}
+
+/**
+ * @brief Module internal function to restore prev and tail after sorting through next.
+ * 
+ * @param list The sorted linked list.
+ */
+void relink(linked_list_t* list) {
+  assert(list);
+
+  node_t* prev = NULL;
+
+  for (node_t* node = list->head; node != NULL; node = node->next) {
+    node->prev = prev;
+    prev = node;
+  }
+
+  list->tail = prev;
+
+  if (list->positions != NULL) {
+    node_positions_invalidate(list->positions);
+  }
+}
+
+/**
+ * @brief Module internal function to move a node in front of an earlier node of the same list.
+ * 
+ * @param list The linked list holding both nodes.
+ * @param node The node to move.
+ * @param next The node to move it in front of.
+ */
+void move_before(linked_list_t* list, node_t* node, node_t* next) {
+  assert(list);
+  assert(node);
+  assert(next);
+
+  node->prev->next = node->next;
+
+  if (node->next != NULL) {
+    node->next->prev = node->prev;
+  } else {
+    list->tail = node->prev;
+  }
+
+  node->prev = next->prev;
+  node->next = next;
+
+  if (next->prev != NULL) {
+    next->prev->next = node;
+  } else {
+    list->head = node;
+  }
+
+  next->prev = node;
+}
+
+/**
+ * @brief Module internal function to relink every node of a list in the order given.
+ * 
+ * @param list The linked list to relink.
+ * @param order Every node of the list in the order they should be linked.
+ * @param count The number of nodes.
+ */
+void relink_from(linked_list_t* list, const keyed_node_t* order, size_t count) {
+  assert(list);
+  assert(order);
+  assert(count > 0);
+
+  node_t* prev = NULL;
+
+  for (size_t i = 0; i < count; i++) {
+    link_in_order(order[i].node, &prev);
+  }
+
+  finish_relink(list, order[0].node, prev);
+}
+
+/**
+ * @brief Module internal function to relink every node of a list in the order of the key pairs given.
+ * 
+ * @param list The linked list to relink.
+ * @param order Every node of the list paired with its key, in the order they should be linked.
+ * @param count The number of nodes.
+ */
+void relink_pairs(linked_list_t* list, const key_pair_t* order, size_t count) {
+  assert(list);
+  assert(order);
+  assert(count > 0);
+
+  node_t* prev = NULL;
+
+  for (size_t i = 0; i < count; i++) {
+    link_in_order(order[i].node, &prev);
+  }
+
+  finish_relink(list, order[0].node, prev);
+}
+
+/**
+ * @brief Module internal function to link a node after the node linked before it while relinking a list.
+ * 
+ * @param node The node to link.
+ * @param prev The node linked last, or NULL before the first, updated to node.
+ */
+void link_in_order(node_t* node, node_t** prev) {
+  assert(node);
+  assert(prev);
+
+  node->prev = *prev;
+
+  if (*prev != NULL) {
+    (*prev)->next = node;
+  }
+
+  *prev = node;
+}
+
+/**
+ * @brief Module internal function to finish relinking a list from its new first and last nodes.
+ * 
+ * @param list The linked list relinked.
+ * @param first The first node.
+ * @param last The last node.
+ */
+void finish_relink(linked_list_t* list, node_t* first, node_t* last) {
+  assert(list);
+  assert(first);
+  assert(last);
+
+  last->next = NULL;
+
+  list->head = first;
+  list->tail = last;
+
+  if (list->positions != NULL) {
+    node_positions_invalidate(list->positions);
+  }
+}
+
+/**
+ * @brief Module internal function to sort keyed nodes with an introsort.
+ *
+ * Quicksort with a median of three pivot, recursing into the smaller partition only,
+ * falling back to heap sort once depth runs out and to insertion sort for small ranges.
+ * 
+ * @param nodes The keyed nodes to sort.
+ * @param count The number of keyed nodes.
+ * @param depth The number of partitioning levels left before falling back to heap sort.
+ * @param order The order to sort in.
+ */
+void introsort(keyed_node_t* nodes, size_t count, size_t depth, const keyed_order_t* order) {
+  assert(order);
+
+  while (count > INTROSORT_MIN_PARTITION) {
+    if (depth == 0) {
+      heap_sort(nodes, count, order);
+      return;
+    }
+
+    depth--;
+
+    size_t pivot = partition(nodes, count, order);
+    size_t right = count - pivot - 1;
+
+    if (pivot < right) {
+      introsort(nodes, pivot, depth, order);
+      nodes += pivot + 1;
+      count = right;
+    } else {
+      introsort(nodes + pivot + 1, right, depth, order);
+      count = pivot;
+    }
+  }
+
+  insertion_sort(nodes, count, order);
+}
+
+/**
+ * @brief Module internal function to partition keyed nodes around the median of the first, middle and last.
+ * 
+ * @param nodes The keyed nodes to partition, at least three.
+ * @param count The number of keyed nodes.
+ * @param order The order to sort in.
+ * @return The final position of the pivot.
+ */
+size_t partition(keyed_node_t* nodes, size_t count, const keyed_order_t* order) {
+  assert(nodes);
+  assert(count >= 3);
+
+  size_t middle = count / 2;
+  size_t last = count - 1;
+
+  if (compare_keyed(&nodes[middle], &nodes[0], order) < 0) {
+    swap_keyed(&nodes[middle], &nodes[0]);
+  }
+
+  if (compare_keyed(&nodes[last], &nodes[middle], order) < 0) {
+    swap_keyed(&nodes[last], &nodes[middle]);
+
+    if (compare_keyed(&nodes[middle], &nodes[0], order) < 0) {
+      swap_keyed(&nodes[middle], &nodes[0]);
+    }
+  }
+
+  swap_keyed(&nodes[0], &nodes[middle]);
+
+  keyed_node_t pivot = nodes[0];
+  size_t i = 0;
+  size_t j = last;
+
+  for (;;) {
+    do {
+      i++;
+    } while (compare_keyed(&nodes[i], &pivot, order) < 0);
+
+    do {
+      j--;
+    } while (compare_keyed(&pivot, &nodes[j], order) < 0);
+
+    if (i >= j) {
+      break;
+    }
+
+    swap_keyed(&nodes[i], &nodes[j]);
+  }
+
+  swap_keyed(&nodes[0], &nodes[j]);
+
+  return j;
+}
+
+/**
+ * @brief Module internal function to sort keyed nodes with a heap sort.
+ * 
+ * @param nodes The keyed nodes to sort.
+ * @param count The number of keyed nodes.
+ * @param order The order to sort in.
+ */
+void heap_sort(keyed_node_t* nodes, size_t count, const keyed_order_t* order) {
+  for (size_t root = count / 2; root > 0; root--) {
+    sift_down(nodes, root - 1, count, order);
+  }
+
+  for (size_t end = count - 1; end > 0; end--) {
+    swap_keyed(&nodes[0], &nodes[end]);
+    sift_down(nodes, 0, end, order);
+  }
+}
+
+/**
+ * @brief Module internal function to restore the max heap property below a root.
+ * 
+ * @param nodes The keyed nodes forming the heap.
+ * @param root The position to sift down from.
+ * @param count The number of keyed nodes in the heap.
+ * @param order The order to sort in.
+ */
+void sift_down(keyed_node_t* nodes, size_t root, size_t count, const keyed_order_t* order) {
+  for (;;) {
+    size_t child = root * 2 + 1;
+
+    if (child >= count) {
+      return;
+    }
+
+    if (child + 1 < count && compare_keyed(&nodes[child], &nodes[child + 1], order) < 0) {
+      child++;
+    }
+
+    if (compare_keyed(&nodes[root], &nodes[child], order) >= 0) {
+      return;
+    }
+
+    swap_keyed(&nodes[root], &nodes[child]);
+    root = child;
+  }
+}
+
+/**
+ * @brief Module internal function to sort keyed nodes with an insertion sort.
+ * 
+ * @param nodes The keyed nodes to sort.
+ * @param count The number of keyed nodes.
+ * @param order The order to sort in.
+ */
+void insertion_sort(keyed_node_t* nodes, size_t count, const keyed_order_t* order) {
+  for (size_t i = 1; i < count; i++) {
+    keyed_node_t current = nodes[i];
+    size_t j = i;
+
+    while (j > 0 && compare_keyed(&current, &nodes[j - 1], order) < 0) {
+      nodes[j] = nodes[j - 1];
+      j--;
+    }
+
+    nodes[j] = current;
+  }
+}
+
+/**
+ * @brief Module internal function to compare two keyed nodes, by key prefix first when prefixed.
+ * 
+ * @param a The first keyed node.
+ * @param b The second keyed node.
+ * @param order The order to sort in.
+ * @return Less than, equal to or greater than zero as a orders before, with or after b.
+ */
+int compare_keyed(const keyed_node_t* a, const keyed_node_t* b, const keyed_order_t* order) {
+  if (order->prefixed && a->key != b->key) {
+    return a->key < b->key ? -1 : 1;
+  }
+
+  return comparator_compare(order->comparator, a->data, b->data);
+}
+
+/**
+ * @brief Module internal function to swap two keyed nodes.
+ * 
+ * @param a The first keyed node.
+ * @param b The second keyed node.
+ */
+void swap_keyed(keyed_node_t* a, keyed_node_t* b) {
+  keyed_node_t swap = *a;
+  *a = *b;
+  *b = swap;
+}
+
+/**
+ * @brief Module internal function to run tasks concurrently, one per thread.
+ *
+ * The first task runs on the calling thread, as does any task a thread can't be created for.
+ * 
+ * @param tasks The tasks to run.
+ * @param count The number of tasks.
+ * @param work The function to run each task with.
+ */
+void run_tasks(sort_task_t* tasks, size_t count, void* (*work)(void*)) {
+  assert(tasks);
+  assert(work);
+
+  pthread_t* workers = NULL;
+  bool* started = NULL;
+
+  if (count > 1) {
+    workers = malloc((count - 1) * sizeof(pthread_t));
+    started = calloc(count - 1, sizeof(bool));
+  }
+
+  for (size_t i = 1; i < count; i++) {
+    if (workers != NULL && started != NULL && pthread_create(&workers[i - 1], NULL, work, &tasks[i]) == 0) {
+      started[i - 1] = true;
+    } else {
+      work(&tasks[i]);
+    }
+  }
+
+  work(&tasks[0]);
+
+  for (size_t i = 1; i < count; i++) {
+    if (started != NULL && started[i - 1]) {
+      pthread_join(workers[i - 1], NULL);
+    }
+  }
+
+  free(workers);
+  free(started);
+}
+
+/**
+ * @brief Module internal thread function to sort the chain of a task.
+ * 
+ * @param task The task to run.
+ * @return NULL.
+ */
+void* sort_work(void* task) {
+  sort_task_t* sort = task;
+
+  sort->head = sort_chain(sort->head, sort->comparator);
+
+  return NULL;
+}
+
+/**
+ * @brief Module internal thread function to merge the two sorted chains of a task.
+ * 
+ * @param task The task to run.
+ * @return NULL.
+ */
+void* merge_work(void* task) {
+  sort_task_t* merge = task;
+  node_t* tail = NULL;
+
+  merge->head = merge_runs(merge->head, merge->other, &tail, merge->comparator);
+
+  return NULL;
+}
@@ -0,0 +1,217 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "scds/mpsc_queue.h"
+
+/**
+ * @brief Initializes an empty multi-producer single-consumer queue.
+ * 
+ * @param queue The queue to initialize.
+ * @return 0 on success, -1 on failure.
+ */
+int mpsc_queue_init(mpsc_queue_t *queue) {
+  assert(queue);
+
+  queue->stub.data = NULL;
+  queue->stub.next = NULL;
+  queue->stub.prev = NULL;
+  queue->head = &queue->stub;
+
+  __atomic_store_n(&queue->tail, &queue->stub, __ATOMIC_RELEASE);
+
+  return 0;
+}
+
+/**
+ * @brief Pops and frees every node left in a queue.
+ *
+ * Only called once no producer is pushing any more. As for mpsc_queue_drain the nodes
+ * must have been allocated with malloc, the data they point at is left alone. The queue
+ * is empty afterwards and may be pushed onto again.
+ * 
+ * @param queue The queue to destroy.
+ * @return 0 on success, -1 on failure.
+ */
+int mpsc_queue_destroy(mpsc_queue_t *queue) {
+  assert(queue);
+
+  node_t* node = NULL;
+
+  while ((node = mpsc_queue_pop(queue)) != NULL) {
+    free(node);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Pushes a node onto the tail of a queue, safe to call from any number of threads.
+ *
+ * Wait-free: a single atomic exchange followed by a store. The queue owns the node until
+ * it is popped, nodes drained into a linked list must be allocated with malloc.
+ * 
+ * @param queue The queue to push onto.
+ * @param node The node to push, its data set by the caller.
+ * @return 0 on success, -1 on failure.
+ */
+int mpsc_queue_push(mpsc_queue_t *queue, node_t *node) {
+  assert(queue);
+  assert(node);
+
+  __atomic_store_n(&node->next, NULL, __ATOMIC_RELAXED);
+
+  node_t* prev = __atomic_exchange_n(&queue->tail, node, __ATOMIC_ACQ_REL);
+
+  __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+
+  return 0;
+}
+
+/**
+ * @brief Allocates a node for data and pushes it onto the tail of a queue.
+ * 
+ * @param queue The queue to push onto.
+ * @param data The data to push.
+ * @return 0 on success, -1 on failure.
+ */
+int mpsc_queue_push_data(mpsc_queue_t *queue, void *data) {
+  assert(queue);
+  assert(data);
+
+  node_t* node = NULL;
+
+  if ((node = malloc(sizeof(node_t))) == NULL) {
+    return -1;
+  }
+
+  node->data = data;
+  node->prev = NULL;
+
+  return mpsc_queue_push(queue, node);
+}
+
+/**
+ * @brief Pops the node at the head of a queue, only ever called from the consumer thread.
+ *
+ * Returns NULL when the queue is empty, and also briefly while a producer is between its
+ * exchange and its store, in which case the node becomes visible on a later pop.
+ * 
+ * @param queue The queue to pop from.
+ * @return The popped node, now owned by the caller, or NULL.
+ */
+node_t* mpsc_queue_pop(mpsc_queue_t *queue) {
+  assert(queue);
+
+  node_t* head = queue->head;
+  node_t* next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+
+  if (head == &queue->stub) {
+    if (next == NULL) {
+      return NULL;
+    }
+
+    queue->head = next;
+    head = next;
+    next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+  }
+
+  if (next != NULL) {
+    queue->head = next;
+
+    return head;
+  }
+
+  if (head != __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE)) {
+    return NULL;
+  }
+
+  // The head is the last node, put the stub behind it so it can be handed out.
+  mpsc_queue_push(queue, &queue->stub);
+
+  next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+
+  if (next != NULL) {
+    queue->head = next;
+
+    return head;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Pops a batch of nodes from a queue and appends them to a linked list in one step.
+ *
+ * Only ever called from the consumer thread. The nodes are relinked into an unpooled list
+ * of data pointers and copied into any other, see linked_list_adopt. If appending fails
+ * the batch is put back at the head of the queue, in order.
+ * 
+ * @param queue The queue to pop from.
+ * @param list The linked list to append to.
+ * @param max The maximum number of nodes to drain, 0 for every node available.
+ * @param drained Optional out parameter containing the number of nodes appended.
+ * @return 0 on success, -1 on failure.
+ */
+int mpsc_queue_drain(mpsc_queue_t *queue, linked_list_t *list, size_t max, size_t *drained) {
+  assert(queue);
+  assert(list);
+
+  node_t* first = NULL;
+  node_t* last = NULL;
+  node_t* node = NULL;
+  size_t count = 0;
+  int result = 0;
+
+  while ((max == 0 || count < max) && (node = mpsc_queue_pop(queue)) != NULL) {
+    if (last == NULL) {
+      first = node;
+    } else {
+      last->next = node;
+    }
+
+    last = node;
+    count++;
+  }
+
+  if (count > 0) {
+    last->next = NULL;
+
+    if (linked_list_adopt(list, first, last, count) == -1) {
+      // Popped nodes are never the tail, so the consumer alone can relink them in front.
+      last->next = queue->head;
+      queue->head = first;
+      count = 0;
+      result = -1;
+    }
+  }
+
+  if (drained != NULL) {
+    *drained = count;
+  }
+
+  return result;
+}
@@ -0,0 +1,297 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "node_index.h"
+
+#define NODE_INDEX_MIN_CAPACITY 16
+
+/**
+ * Represents a slot in the index, a NULL node marks the slot as empty.
+ */
+typedef struct node_index_entry {
+  const void *data;
+  node_t *node;
+} node_index_entry_t;
+
+/**
+ * Represents an open addressed, linearly probed table from data pointer to node.
+ */
+struct node_index {
+  node_index_entry_t *entries;
+  size_t capacity;
+  size_t count;
+  size_t rehashes;
+  size_t rehashed_entries;
+};
+
+static size_t slot_for(const node_index_t *index, const void *data);
+static int grow(node_index_t *index);
+
+/**
+ * @brief Create a new node index.
+ *
+ * @param capacity The number of nodes to size the index for.
+ * @return A pointer to the newly created index or NULL on failure.
+ */
+node_index_t* node_index_new(size_t capacity) {
+  node_index_t *index = NULL;
+
+  if ((index = malloc(sizeof(node_index_t))) == NULL) {
+    return NULL;
+  }
+
+  size_t slots = NODE_INDEX_MIN_CAPACITY;
+
+  while (slots / 4 * 3 < capacity) {
+    slots *= 2;
+  }
+
+  if ((index->entries = calloc(slots, sizeof(node_index_entry_t))) == NULL) {
+    free(index);
+
+    return NULL;
+  }
+
+  index->capacity = slots;
+  index->count = 0;
+  index->rehashes = 0;
+  index->rehashed_entries = 0;
+
+  return index;
+}
+
+/**
+ * @brief Frees a node index.
+ *
+ * @param index The index to free.
+ * @return 0 on success, -1 on failure.
+ */
+int node_index_free(node_index_t *index) {
+  assert(index);
+
+  free(index->entries);
+  free(index);
+
+  return 0;
+}
+
+/**
+ * @brief Adds a node to the index, keyed by its data pointer.
+ *
+ * @param index The index to add to.
+ * @param node The node to add.
+ * @return 0 on success, -1 on failure.
+ */
+int node_index_insert(node_index_t *index, node_t *node) {
+  assert(index);
+  assert(node);
+
+  if (index->count + 1 > index->capacity / 4 * 3) {
+    if (grow(index) == -1) {
+      return -1;
+    }
+  }
+
+  size_t mask = index->capacity - 1;
+  size_t slot = slot_for(index, node->data);
+
+  while (index->entries[slot].node != NULL) {
+    slot = (slot + 1) & mask;
+  }
+
+  index->entries[slot].data = node->data;
+  index->entries[slot].node = node;
+  index->count++;
+
+  return 0;
+}
+
+/**
+ * @brief Removes a node from the index using backward shift deletion.
+ *
+ * @param index The index to remove from.
+ * @param node The node to remove.
+ * @return 0 on success, -1 if the node isn't indexed.
+ */
+int node_index_remove(node_index_t *index, node_t *node) {
+  assert(index);
+  assert(node);
+
+  size_t mask = index->capacity - 1;
+  size_t slot = slot_for(index, node->data);
+
+  while (index->entries[slot].node != node) {
+    if (index->entries[slot].node == NULL) {
+      return -1;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  size_t hole = slot;
+
+  for (size_t next = (hole + 1) & mask; index->entries[next].node != NULL; next = (next + 1) & mask) {
+    size_t home = slot_for(index, index->entries[next].data);
+
+    // Only shift entries whose home slot doesn't lie in the cyclic range (hole, next].
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      index->entries[hole] = index->entries[next];
+      hole = next;
+    }
+  }
+
+  index->entries[hole].data = NULL;
+  index->entries[hole].node = NULL;
+  index->count--;
+
+  return 0;
+}
+
+/**
+ * @brief Finds a node holding the given data pointer.
+ *
+ * @param index The index to search.
+ * @param data The data pointer to find.
+ * @return A node holding data or NULL if there is none.
+ */
+node_t* node_index_find(const node_index_t *index, const void *data) {
+  assert(index);
+
+  size_t mask = index->capacity - 1;
+  size_t slot = slot_for(index, data);
+
+  while (index->entries[slot].node != NULL) {
+    if (index->entries[slot].data == data) {
+      return index->entries[slot].node;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Removes every node from the index, keeping its capacity.
+ *
+ * @param index The index to clear.
+ * @return 0 on success, -1 on failure.
+ */
+int node_index_clear(node_index_t *index) {
+  assert(index);
+
+  if (index->count > 0) {
+    memset(index->entries, 0, index->capacity * sizeof(node_index_entry_t));
+  }
+
+  index->count = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Reports the memory overhead and rehash cost of the index.
+ *
+ * @param index The index to report on.
+ * @param stats Out parameter populated with the statistics.
+ * @return 0 on success, -1 on failure.
+ */
+int node_index_stats(const node_index_t *index, linked_list_index_stats_t *stats) {
+  assert(index);
+  assert(stats);
+
+  stats->entries = index->count;
+  stats->capacity = index->capacity;
+  stats->memory = sizeof(node_index_t) + index->capacity * sizeof(node_index_entry_t);
+  stats->rehashes = index->rehashes;
+  stats->rehashed_entries = index->rehashed_entries;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to find the home slot of a data pointer.
+ *
+ * @param index The index the slot is for.
+ * @param data The data pointer to hash.
+ * @return The home slot.
+ */
+size_t slot_for(const node_index_t *index, const void *data) {
+  uint64_t hash = (uint64_t) (uintptr_t) data;
+
+  hash ^= hash >> 33;
+  hash *= UINT64_C(0xff51afd7ed558ccd);
+  hash ^= hash >> 33;
+
+  return (size_t) hash & (index->capacity - 1);
+}
+
+/**
+ * @brief Module internal function to double the capacity of the index and rehash it.
+ *
+ * @param index The index to grow.
+ * @return 0 on success, -1 on failure.
+ */
+int grow(node_index_t *index) {
+  assert(index);
+
+  node_index_entry_t *old = index->entries;
+  size_t old_capacity = index->capacity;
+  node_index_entry_t *entries = NULL;
+
+  if ((entries = calloc(old_capacity * 2, sizeof(node_index_entry_t))) == NULL) {
+    return -1;
+  }
+
+  index->entries = entries;
+  index->capacity = old_capacity * 2;
+
+  size_t mask = index->capacity - 1;
+
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old[i].node == NULL) {
+      continue;
+    }
+
+    size_t slot = slot_for(index, old[i].data);
+
+    while (entries[slot].node != NULL) {
+      slot = (slot + 1) & mask;
+    }
+
+    entries[slot] = old[i];
+  }
+
+  index->rehashes++;
+  index->rehashed_entries += index->count;
+
+  free(old);
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_NODE_INDEX_H
+#define SCDS_NODE_INDEX_H
+
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Functions
+ */
+node_index_t* node_index_new(size_t capacity);
+int node_index_free(node_index_t *index);
+
+int node_index_insert(node_index_t *index, node_t *node);
+int node_index_remove(node_index_t *index, node_t *node);
+node_t* node_index_find(const node_index_t *index, const void *data);
+int node_index_clear(node_index_t *index);
+int node_index_stats(const node_index_t *index, linked_list_index_stats_t *stats);
+
+#endif
@@ -0,0 +1,384 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "node_pool.h"
+
+#define NODE_POOL_DEFAULT_CHUNK_SLOTS 1024
+#define NODE_POOL_MAX_ARENA_CHUNK_SLOTS (1 << 20)
+
+/**
+ * Represents a single contiguous allocation that nodes are carved from.
+ */
+typedef struct node_chunk {
+  struct node_chunk *next;
+  size_t capacity;
+  size_t used;
+  max_align_t slots[];
+} node_chunk_t;
+
+/**
+ * Represents a pool of equally sized node slots.
+ */
+struct node_pool {
+  node_chunk_t *chunks;
+  node_t *free_list;
+  size_t slot_size;
+  size_t chunk_slots;
+  bool arena;
+};
+
+static node_chunk_t* add_chunk(node_pool_t *pool, size_t capacity);
+
+/**
+ * @brief Create a new node pool.
+ *
+ * @param slot_size The size in bytes of each slot, at least sizeof(node_t).
+ * @param chunk_slots The number of slots per chunk, 0 for the default.
+ * @return A pointer to the newly created pool or NULL on failure.
+ */
+node_pool_t* node_pool_new(size_t slot_size, size_t chunk_slots) {
+  assert(slot_size >= sizeof(node_t));
+
+  node_pool_t *pool = NULL;
+
+  if ((pool = malloc(sizeof(node_pool_t))) == NULL) {
+    return NULL;
+  }
+
+  size_t align = _Alignof(max_align_t);
+
+  pool->chunks = NULL;
+  pool->free_list = NULL;
+  pool->slot_size = (slot_size + align - 1) / align * align;
+  pool->chunk_slots = chunk_slots > 0 ? chunk_slots : NODE_POOL_DEFAULT_CHUNK_SLOTS;
+  pool->arena = false;
+
+  return pool;
+}
+
+/**
+ * @brief Create a new node pool used as a bump arena.
+ *
+ * Behaves as a pool whose chunks double in size, up to a limit, each time one is
+ * added, so that node_pool_reset, costing one free per chunk beyond the largest, has
+ * few chunks to release however many nodes were allocated.
+ *
+ * @param slot_size The size in bytes of each slot, at least sizeof(node_t).
+ * @param chunk_slots The number of slots in the first chunk, 0 for the default.
+ * @return A pointer to the newly created pool or NULL on failure.
+ */
+node_pool_t* node_pool_new_arena(size_t slot_size, size_t chunk_slots) {
+  node_pool_t *pool = NULL;
+
+  if ((pool = node_pool_new(slot_size, chunk_slots)) == NULL) {
+    return NULL;
+  }
+
+  pool->arena = true;
+
+  return pool;
+}
+
+/**
+ * @brief Frees a node pool and every chunk it owns.
+ *
+ * @param pool The pool to free.
+ * @return 0 on success, -1 on failure.
+ */
+int node_pool_free(node_pool_t *pool) {
+  assert(pool);
+
+  node_chunk_t *chunk = pool->chunks;
+
+  while (chunk != NULL) {
+    node_chunk_t *next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+
+  free(pool);
+
+  return 0;
+}
+
+/**
+ * @brief Takes a node from the pool, recycling released nodes first.
+ *
+ * @param pool The pool to allocate from.
+ * @return The allocated node or NULL on failure.
+ */
+node_t* node_pool_alloc(node_pool_t *pool) {
+  assert(pool);
+
+  if (pool->free_list != NULL) {
+    node_t *node = pool->free_list;
+    pool->free_list = node->next;
+
+    return node;
+  }
+
+  node_chunk_t *chunk = pool->chunks;
+
+  if (chunk == NULL || chunk->used == chunk->capacity) {
+    if ((chunk = add_chunk(pool, pool->chunk_slots)) == NULL) {
+      return NULL;
+    }
+  }
+
+  node_t *node = (node_t *) ((char *) chunk->slots + chunk->used * pool->slot_size);
+  chunk->used++;
+
+  return node;
+}
+
+/**
+ * @brief Takes count nodes from the pool, linked through next.
+ *
+ * Released nodes are recycled first, then the remainder of the current chunk is used and
+ * at most one further chunk is allocated for the rest, so a batch costs at most a single
+ * allocation.
+ *
+ * @param pool The pool to allocate from.
+ * @param count The number of nodes to take, at least one.
+ * @param first Out parameter containing the first node of the chain.
+ * @param last Out parameter containing the last node of the chain.
+ * @return 0 on success, -1 on failure.
+ */
+int node_pool_alloc_chain(node_pool_t *pool, size_t count, node_t **first, node_t **last) {
+  assert(pool);
+  assert(count > 0);
+  assert(first);
+  assert(last);
+
+  node_t *head = NULL;
+  node_t *tail = NULL;
+  size_t recycled = 0;
+
+  for (node_t *node = pool->free_list; node != NULL && recycled < count; node = node->next) {
+    tail = node;
+    recycled++;
+  }
+
+  node_chunk_t *chunk = pool->chunks;
+  size_t available = chunk != NULL ? chunk->capacity - chunk->used : 0;
+  node_chunk_t *extra = NULL;
+
+  if (recycled + available < count) {
+    size_t needed = count - recycled - available;
+    size_t capacity = needed > pool->chunk_slots ? needed : pool->chunk_slots;
+
+    if ((extra = add_chunk(pool, capacity)) == NULL) {
+      return -1;
+    }
+  }
+
+  if (recycled > 0) {
+    head = pool->free_list;
+    pool->free_list = tail->next;
+    count -= recycled;
+  }
+
+  node_chunk_t *sources[2] = { chunk, extra };
+
+  for (size_t i = 0; i < 2 && count > 0; i++) {
+    node_chunk_t *from = sources[i];
+
+    if (from == NULL) {
+      continue;
+    }
+
+    size_t take = from->capacity - from->used < count ? from->capacity - from->used : count;
+    char *slot = (char *) from->slots + from->used * pool->slot_size;
+
+    for (size_t j = 0; j < take; j++, slot += pool->slot_size) {
+      node_t *node = (node_t *) slot;
+
+      if (tail != NULL) {
+        tail->next = node;
+      } else {
+        head = node;
+      }
+
+      tail = node;
+    }
+
+    from->used += take;
+    count -= take;
+  }
+
+  tail->next = NULL;
+
+  *first = head;
+  *last = tail;
+
+  return 0;
+}
+
+/**
+ * @brief Returns a single node to the pool.
+ *
+ * @param pool The pool the node was allocated from.
+ * @param node The node to return.
+ * @return 0 on success, -1 on failure.
+ */
+int node_pool_release(node_pool_t *pool, node_t *node) {
+  assert(pool);
+  assert(node);
+
+  node->next = pool->free_list;
+  pool->free_list = node;
+
+  return 0;
+}
+
+/**
+ * @brief Returns a chain of nodes linked through next to the pool in constant time.
+ *
+ * @param pool The pool the nodes were allocated from.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ * @return 0 on success, -1 on failure.
+ */
+int node_pool_release_chain(node_pool_t *pool, node_t *first, node_t *last) {
+  assert(pool);
+  assert(first);
+  assert(last);
+
+  last->next = pool->free_list;
+  pool->free_list = first;
+
+  return 0;
+}
+
+/**
+ * @brief Returns every node of the pool at once without visiting them.
+ *
+ * The largest chunk is kept and rewound for reuse and the others are released, at the
+ * cost of one free per extra chunk. Nodes taken from the pool must no longer be used.
+ *
+ * @param pool The pool to reset.
+ * @return 0 on success, -1 on failure.
+ */
+int node_pool_reset(node_pool_t *pool) {
+  assert(pool);
+
+  node_chunk_t *largest = pool->chunks;
+
+  for (node_chunk_t *chunk = pool->chunks; chunk != NULL; chunk = chunk->next) {
+    if (chunk->capacity > largest->capacity) {
+      largest = chunk;
+    }
+  }
+
+  node_chunk_t *chunk = pool->chunks;
+
+  while (chunk != NULL) {
+    node_chunk_t *next = chunk->next;
+
+    if (chunk != largest) {
+      free(chunk);
+    }
+
+    chunk = next;
+  }
+
+  if (largest != NULL) {
+    largest->next = NULL;
+    largest->used = 0;
+  }
+
+  pool->chunks = largest;
+  pool->free_list = NULL;
+
+  return 0;
+}
+
+/**
+ * @brief Reports the memory a pool holds in chunks.
+ *
+ * @param pool The pool to report on.
+ * @param stats Out parameter populated with the statistics.
+ * @return 0 on success, -1 on failure.
+ */
+int node_pool_stats(const node_pool_t *pool, linked_list_pool_stats_t *stats) {
+  assert(pool);
+  assert(stats);
+
+  stats->chunks = 0;
+  stats->capacity = 0;
+  stats->memory = sizeof(node_pool_t);
+
+  for (const node_chunk_t *chunk = pool->chunks; chunk != NULL; chunk = chunk->next) {
+    stats->chunks++;
+    stats->capacity += chunk->capacity;
+    stats->memory += sizeof(node_chunk_t) + chunk->capacity * pool->slot_size;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Reports whether a pool is used as a bump arena.
+ *
+ * @param pool The pool.
+ * @return true if the pool was created by node_pool_new_arena, false otherwise.
+ */
+bool node_pool_is_arena(const node_pool_t *pool) {
+  assert(pool);
+
+  return pool->arena;
+}
+
+/**
+ * @brief Module internal function to allocate a new chunk and make it current.
+ *
+ * @param pool The pool to add the chunk to.
+ * @param capacity The number of slots in the chunk.
+ * @return The new chunk or NULL on failure.
+ */
+node_chunk_t* add_chunk(node_pool_t *pool, size_t capacity) {
+  assert(pool);
+  assert(capacity > 0);
+
+  node_chunk_t *chunk = NULL;
+
+  if ((chunk = malloc(sizeof(node_chunk_t) + capacity * pool->slot_size)) == NULL) {
+    return NULL;
+  }
+
+  chunk->next = pool->chunks;
+  chunk->capacity = capacity;
+  chunk->used = 0;
+
+  pool->chunks = chunk;
+
+  if (pool->arena && pool->chunk_slots < NODE_POOL_MAX_ARENA_CHUNK_SLOTS) {
+    pool->chunk_slots *= 2;
+  }
+
+  return chunk;
+}
@@ -0,0 +1,48 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_NODE_POOL_H
+#define SCDS_NODE_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "scds/linked_list.h"
+
+/**
+ * Functions
+ */
+node_pool_t* node_pool_new(size_t slot_size, size_t chunk_slots);
+node_pool_t* node_pool_new_arena(size_t slot_size, size_t chunk_slots);
+int node_pool_free(node_pool_t *pool);
+
+node_t* node_pool_alloc(node_pool_t *pool);
+int node_pool_alloc_chain(node_pool_t *pool, size_t count, node_t **first, node_t **last);
+int node_pool_release(node_pool_t *pool, node_t *node);
+int node_pool_release_chain(node_pool_t *pool, node_t *first, node_t *last);
+int node_pool_reset(node_pool_t *pool);
+bool node_pool_is_arena(const node_pool_t *pool);
+int node_pool_stats(const node_pool_t *pool, linked_list_pool_stats_t *stats);
+
+#endif
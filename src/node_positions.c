@@ -0,0 +1,678 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "node_positions.h"
+
+#define NIL 0
+
+/**
+ * Represents a node of the implicit treap, entry NIL is a sentinel of size 0.
+ */
+typedef struct position_entry {
+  node_t *node;
+  uint32_t left;
+  uint32_t right;
+  uint32_t size;
+  uint32_t priority;
+} position_entry_t;
+
+/**
+ * Represents an implicit treap over the nodes of a linked list in list order.
+ *
+ * Appends are buffered in pending and merged in bulk on the next positional query.
+ * Once stale the treap is rebuilt from the list on the next positional query.
+ */
+struct node_positions {
+  position_entry_t *entries;
+  uint32_t capacity;
+  uint32_t used;
+  uint32_t free_list;
+  uint32_t root;
+  uint32_t seed;
+  node_t **pending;
+  size_t pending_count;
+  size_t pending_capacity;
+  bool stale;
+};
+
+static int sync(node_positions_t *positions, const linked_list_t *list);
+static int rebuild(node_positions_t *positions, const linked_list_t *list);
+static int reserve(node_positions_t *positions, size_t count);
+static uint32_t new_entry(node_positions_t *positions, node_t *node);
+static uint32_t build(node_positions_t *positions, uint32_t *ids, size_t count);
+static uint32_t merge(node_positions_t *positions, uint32_t left, uint32_t right);
+static void split(node_positions_t *positions, uint32_t tree, size_t count, uint32_t *left, uint32_t *right);
+static void update(node_positions_t *positions, uint32_t id);
+static uint32_t next_priority(node_positions_t *positions);
+
+/**
+ * @brief Create a new, stale, positional index.
+ *
+ * @return A pointer to the newly created index or NULL on failure.
+ */
+node_positions_t* node_positions_new(void) {
+  node_positions_t *positions = NULL;
+
+  if ((positions = malloc(sizeof(node_positions_t))) == NULL) {
+    return NULL;
+  }
+
+  if ((positions->entries = malloc(sizeof(position_entry_t))) == NULL) {
+    free(positions);
+
+    return NULL;
+  }
+
+  positions->entries[NIL].node = NULL;
+  positions->entries[NIL].left = NIL;
+  positions->entries[NIL].right = NIL;
+  positions->entries[NIL].size = 0;
+  positions->entries[NIL].priority = 0;
+
+  positions->capacity = 1;
+  positions->used = 1;
+  positions->free_list = NIL;
+  positions->root = NIL;
+  positions->seed = 0x9e3779b9U;
+  positions->pending = NULL;
+  positions->pending_count = 0;
+  positions->pending_capacity = 0;
+  positions->stale = true;
+
+  return positions;
+}
+
+/**
+ * @brief Frees a positional index.
+ *
+ * @param positions The index to free.
+ * @return 0 on success, -1 on failure.
+ */
+int node_positions_free(node_positions_t *positions) {
+  assert(positions);
+
+  free(positions->entries);
+  free(positions->pending);
+  free(positions);
+
+  return 0;
+}
+
+/**
+ * @brief Records a node appended to the end of the list in amortised constant time.
+ *
+ * @param positions The index to record the node in.
+ * @param node The appended node.
+ * @return 0 on success, -1 on failure.
+ */
+int node_positions_append(node_positions_t *positions, node_t *node) {
+  assert(positions);
+  assert(node);
+
+  if (positions->stale) {
+    return 0;
+  }
+
+  if (positions->pending_count == positions->pending_capacity) {
+    size_t capacity = positions->pending_capacity > 0 ? positions->pending_capacity * 2 : 16;
+    node_t **pending = NULL;
+
+    if ((pending = realloc(positions->pending, capacity * sizeof(node_t *))) == NULL) {
+      return -1;
+    }
+
+    positions->pending = pending;
+    positions->pending_capacity = capacity;
+  }
+
+  positions->pending[positions->pending_count++] = node;
+
+  return 0;
+}
+
+/**
+ * @brief Records a node inserted at the given position, before it is linked into the list.
+ *
+ * @param positions The index to record the node in.
+ * @param list The linked list the index belongs to.
+ * @param index The position the node is inserted at.
+ * @param node The inserted node.
+ * @return 0 on success, -1 on failure.
+ */
+int node_positions_insert_at(node_positions_t *positions, const linked_list_t *list, size_t index, node_t *node) {
+  assert(positions);
+  assert(list);
+  assert(index <= list->size);
+  assert(node);
+
+  if (sync(positions, list) == -1 || reserve(positions, 1) == -1) {
+    return -1;
+  }
+
+  uint32_t left = NIL;
+  uint32_t right = NIL;
+
+  split(positions, positions->root, index, &left, &right);
+
+  uint32_t id = new_entry(positions, node);
+
+  positions->root = merge(positions, merge(positions, left, id), right);
+
+  return 0;
+}
+
+/**
+ * @brief Forgets the node at the given position, before it is unlinked from the list.
+ *
+ * @param positions The index to remove from.
+ * @param list The linked list the index belongs to.
+ * @param index The position of the node.
+ * @return The node at the position or NULL on failure.
+ */
+node_t* node_positions_remove_at(node_positions_t *positions, const linked_list_t *list, size_t index) {
+  assert(positions);
+  assert(list);
+  assert(index < list->size);
+
+  if (sync(positions, list) == -1) {
+    return NULL;
+  }
+
+  uint32_t left = NIL;
+  uint32_t middle = NIL;
+  uint32_t right = NIL;
+
+  split(positions, positions->root, index, &left, &right);
+  split(positions, right, 1, &middle, &right);
+
+  positions->root = merge(positions, left, right);
+
+  node_t *node = positions->entries[middle].node;
+
+  positions->entries[middle].left = positions->free_list;
+  positions->free_list = middle;
+
+  return node;
+}
+
+/**
+ * @brief Finds the node at the given position in logarithmic time.
+ *
+ * @param positions The index to search.
+ * @param list The linked list the index belongs to.
+ * @param index The position of the node.
+ * @return The node at the position or NULL on failure.
+ */
+node_t* node_positions_at(node_positions_t *positions, const linked_list_t *list, size_t index) {
+  assert(positions);
+  assert(list);
+  assert(index < list->size);
+
+  if (sync(positions, list) == -1) {
+    return NULL;
+  }
+
+  position_entry_t *entries = positions->entries;
+  uint32_t id = positions->root;
+
+  while (id != NIL) {
+    size_t left_size = entries[entries[id].left].size;
+
+    if (index < left_size) {
+      id = entries[id].left;
+    } else if (index == left_size) {
+      return entries[id].node;
+    } else {
+      index -= left_size + 1;
+      id = entries[id].right;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Finds the first node comparing greater than data in logarithmic time.
+ *
+ * The list must be sorted by the comparator. The treap is descended once, comparing
+ * against each node passed and counting the nodes left behind for the position.
+ *
+ * @param positions The index to search.
+ * @param list The linked list the index belongs to.
+ * @param comparator The comparator the list is sorted by.
+ * @param data The data to compare against.
+ * @param node Set to the node found, or NULL if data sorts at the end.
+ * @param index Set to the position of the node found, or the size of the list.
+ * @return 0 on success, -1 on failure.
+ */
+int node_positions_upper_bound(node_positions_t *positions, const linked_list_t *list, const comparator_t *comparator, const void *data, node_t **node, size_t *index) {
+  assert(positions);
+  assert(list);
+  assert(comparator);
+  assert(data);
+  assert(node);
+  assert(index);
+
+  if (sync(positions, list) == -1) {
+    return -1;
+  }
+
+  position_entry_t *entries = positions->entries;
+  uint32_t id = positions->root;
+  size_t before = 0;
+
+  *node = NULL;
+  *index = list->size;
+
+  while (id != NIL) {
+    if (comparator_compare(comparator, entries[id].node->data, data) > 0) {
+      *node = entries[id].node;
+      *index = before + entries[entries[id].left].size;
+      id = entries[id].left;
+    } else {
+      before += entries[entries[id].left].size + 1;
+      id = entries[id].right;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Checks whether the index needs rebuilding before its next positional query.
+ *
+ * @param positions The index to check.
+ * @return true if the index is stale, false otherwise.
+ */
+bool node_positions_stale(const node_positions_t *positions) {
+  assert(positions);
+
+  return positions->stale;
+}
+
+/**
+ * @brief Marks the index as stale after the list was reordered in an untracked way.
+ *
+ * @param positions The index to invalidate.
+ * @return 0 on success, -1 on failure.
+ */
+int node_positions_invalidate(node_positions_t *positions) {
+  assert(positions);
+
+  positions->stale = true;
+  positions->pending_count = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Empties the index after the list was cleared.
+ *
+ * @param positions The index to clear.
+ * @return 0 on success, -1 on failure.
+ */
+int node_positions_clear(node_positions_t *positions) {
+  assert(positions);
+
+  positions->used = 1;
+  positions->free_list = NIL;
+  positions->root = NIL;
+  positions->pending_count = 0;
+  positions->stale = false;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to bring the treap up to date with the list.
+ *
+ * @param positions The index to synchronise.
+ * @param list The linked list the index belongs to.
+ * @return 0 on success, -1 on failure.
+ */
+int sync(node_positions_t *positions, const linked_list_t *list) {
+  assert(positions);
+  assert(list);
+
+  if (positions->stale) {
+    return rebuild(positions, list);
+  }
+
+  if (positions->pending_count == 0) {
+    return 0;
+  }
+
+  size_t count = positions->pending_count;
+  uint32_t *ids = NULL;
+
+  if (reserve(positions, count) == -1 || (ids = malloc(count * sizeof(uint32_t))) == NULL) {
+    return -1;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    ids[i] = new_entry(positions, positions->pending[i]);
+  }
+
+  uint32_t appended = build(positions, ids, count);
+
+  free(ids);
+
+  if (appended == NIL) {
+    node_positions_invalidate(positions);
+
+    return -1;
+  }
+
+  positions->root = merge(positions, positions->root, appended);
+  positions->pending_count = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to rebuild the treap from the list in linear time.
+ *
+ * @param positions The index to rebuild.
+ * @param list The linked list the index belongs to.
+ * @return 0 on success, -1 on failure.
+ */
+int rebuild(node_positions_t *positions, const linked_list_t *list) {
+  assert(positions);
+  assert(list);
+
+  positions->used = 1;
+  positions->free_list = NIL;
+  positions->root = NIL;
+  positions->pending_count = 0;
+
+  if (list->size == 0) {
+    positions->stale = false;
+
+    return 0;
+  }
+
+  uint32_t *ids = NULL;
+
+  if (reserve(positions, list->size) == -1 || (ids = malloc(list->size * sizeof(uint32_t))) == NULL) {
+    return -1;
+  }
+
+  size_t count = 0;
+
+  for (node_t *node = list->head; node != NULL; node = node->next) {
+    ids[count++] = new_entry(positions, node);
+  }
+
+  positions->root = build(positions, ids, count);
+
+  free(ids);
+
+  if (positions->root == NIL) {
+    positions->used = 1;
+
+    return -1;
+  }
+
+  positions->stale = false;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to ensure entries are available without reallocating.
+ *
+ * @param positions The index to reserve entries in.
+ * @param count The number of entries required.
+ * @return 0 on success, -1 on failure.
+ */
+int reserve(node_positions_t *positions, size_t count) {
+  assert(positions);
+
+  if (count >= UINT32_MAX - positions->used) {
+    return -1;
+  }
+
+  size_t required = (size_t) positions->used + count;
+
+  if (required <= positions->capacity) {
+    return 0;
+  }
+
+  size_t capacity = (size_t) positions->capacity * 2;
+
+  if (capacity < required) {
+    capacity = required;
+  }
+
+  if (capacity > UINT32_MAX) {
+    capacity = UINT32_MAX;
+  }
+
+  position_entry_t *entries = NULL;
+
+  if ((entries = realloc(positions->entries, capacity * sizeof(position_entry_t))) == NULL) {
+    return -1;
+  }
+
+  positions->entries = entries;
+  positions->capacity = (uint32_t) capacity;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to take a reserved entry for a node.
+ *
+ * @param positions The index to take the entry from.
+ * @param node The node the entry refers to.
+ * @return The id of the entry.
+ */
+uint32_t new_entry(node_positions_t *positions, node_t *node) {
+  assert(positions);
+
+  uint32_t id = positions->free_list;
+
+  if (id != NIL) {
+    positions->free_list = positions->entries[id].left;
+  } else {
+    assert(positions->used < positions->capacity);
+
+    id = positions->used++;
+  }
+
+  position_entry_t *entry = &positions->entries[id];
+
+  entry->node = node;
+  entry->left = NIL;
+  entry->right = NIL;
+  entry->size = 1;
+  entry->priority = next_priority(positions);
+
+  return id;
+}
+
+/**
+ * @brief Module internal function to build a treap from entries in order in linear time.
+ *
+ * Builds the cartesian tree with a stack of positions on its right spine. An entry's
+ * subtree spans the positions between the nearest higher priority entries either side
+ * of it, which gives its size without a further pass.
+ *
+ * @param positions The index the entries belong to.
+ * @param ids The entries in list order.
+ * @param count The number of entries.
+ * @return The root of the treap or NIL on failure.
+ */
+uint32_t build(node_positions_t *positions, uint32_t *ids, size_t count) {
+  assert(positions);
+  assert(ids);
+
+  uint32_t *stack = NULL;
+
+  if ((stack = malloc((count + 1) * sizeof(uint32_t))) == NULL) {
+    return NIL;
+  }
+
+  position_entry_t *entries = positions->entries;
+  size_t depth = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    uint32_t id = ids[i];
+    uint32_t last = NIL;
+
+    while (depth > 0 && entries[ids[stack[depth - 1]]].priority < entries[id].priority) {
+      last = ids[stack[--depth]];
+
+      // The popped entry spans up to, but excluding, position i.
+      entries[last].size = (uint32_t) i - entries[last].size;
+    }
+
+    entries[id].left = last;
+
+    if (depth > 0) {
+      entries[ids[stack[depth - 1]]].right = id;
+    }
+
+    // Temporarily hold the first position the entry spans.
+    entries[id].size = depth > 0 ? stack[depth - 1] + 1 : 0;
+    stack[depth++] = (uint32_t) i;
+  }
+
+  while (depth > 0) {
+    uint32_t id = ids[stack[--depth]];
+
+    entries[id].size = (uint32_t) count - entries[id].size;
+  }
+
+  uint32_t root = count > 0 ? ids[stack[0]] : NIL;
+
+  free(stack);
+
+  return root;
+}
+
+/**
+ * @brief Module internal function to concatenate two treaps.
+ *
+ * @param positions The index the treaps belong to.
+ * @param left The treap whose nodes come first.
+ * @param right The treap whose nodes come second.
+ * @return The root of the combined treap.
+ */
+uint32_t merge(node_positions_t *positions, uint32_t left, uint32_t right) {
+  assert(positions);
+
+  position_entry_t *entries = positions->entries;
+
+  if (left == NIL) {
+    return right;
+  }
+
+  if (right == NIL) {
+    return left;
+  }
+
+  if (entries[left].priority >= entries[right].priority) {
+    entries[left].right = merge(positions, entries[left].right, right);
+    update(positions, left);
+
+    return left;
+  }
+
+  entries[right].left = merge(positions, left, entries[right].left);
+  update(positions, right);
+
+  return right;
+}
+
+/**
+ * @brief Module internal function to split a treap after the first count nodes.
+ *
+ * @param positions The index the treap belongs to.
+ * @param tree The treap to split.
+ * @param count The number of nodes to place in the left treap.
+ * @param left Out parameter containing the first count nodes.
+ * @param right Out parameter containing the remaining nodes.
+ */
+void split(node_positions_t *positions, uint32_t tree, size_t count, uint32_t *left, uint32_t *right) {
+  assert(positions);
+  assert(left);
+  assert(right);
+
+  position_entry_t *entries = positions->entries;
+
+  if (tree == NIL) {
+    *left = NIL;
+    *right = NIL;
+
+    return;
+  }
+
+  size_t left_size = entries[entries[tree].left].size;
+
+  if (count <= left_size) {
+    split(positions, entries[tree].left, count, left, &entries[tree].left);
+    *right = tree;
+  } else {
+    split(positions, entries[tree].right, count - left_size - 1, &entries[tree].right, right);
+    *left = tree;
+  }
+
+  update(positions, tree);
+}
+
+/**
+ * @brief Module internal function to recalculate the size of a subtree.
+ *
+ * @param positions The index the entry belongs to.
+ * @param id The root of the subtree.
+ */
+void update(node_positions_t *positions, uint32_t id) {
+  position_entry_t *entries = positions->entries;
+
+  entries[id].size = entries[entries[id].left].size + entries[entries[id].right].size + 1;
+}
+
+/**
+ * @brief Module internal function to generate a treap priority.
+ *
+ * @param positions The index holding the generator state.
+ * @return A pseudo random priority.
+ */
+uint32_t next_priority(node_positions_t *positions) {
+  uint32_t x = positions->seed;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  positions->seed = x;
+
+  return x;
+}
@@ -0,0 +1,49 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SCDS_NODE_POSITIONS_H
+#define SCDS_NODE_POSITIONS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "comparator.h"
+#include "scds/linked_list.h"
+
+/**
+ * Functions
+ */
+node_positions_t* node_positions_new(void);
+int node_positions_free(node_positions_t *positions);
+
+int node_positions_append(node_positions_t *positions, node_t *node);
+int node_positions_insert_at(node_positions_t *positions, const linked_list_t *list, size_t index, node_t *node);
+node_t* node_positions_remove_at(node_positions_t *positions, const linked_list_t *list, size_t index);
+node_t* node_positions_at(node_positions_t *positions, const linked_list_t *list, size_t index);
+int node_positions_upper_bound(node_positions_t *positions, const linked_list_t *list, const comparator_t *comparator, const void *data, node_t **node, size_t *index);
+bool node_positions_stale(const node_positions_t *positions);
+int node_positions_invalidate(node_positions_t *positions);
+int node_positions_clear(node_positions_t *positions);
+
+#endif
@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include "scds/node_reclaimer.h"
+
+static void* reclaim(void* reclaimer);
+
+/**
+ * @brief Initializes a node reclaimer and starts its thread.
+ * 
+ * @param reclaimer The node reclaimer to initialize.
+ * @return 0 on success, -1 on failure.
+ */
+int node_reclaimer_init(node_reclaimer_t *reclaimer) {
+  assert(reclaimer);
+
+  reclaimer->pending = NULL;
+  reclaimer->submitted = 0;
+  reclaimer->reclaimed = 0;
+  reclaimer->freed = 0;
+  reclaimer->stopping = false;
+
+  if (pthread_mutex_init(&reclaimer->lock, NULL) != 0) {
+    return -1;
+  }
+
+  if (pthread_cond_init(&reclaimer->pending_ready, NULL) != 0) {
+    pthread_mutex_destroy(&reclaimer->lock);
+
+    return -1;
+  }
+
+  if (pthread_cond_init(&reclaimer->idle, NULL) != 0) {
+    pthread_cond_destroy(&reclaimer->pending_ready);
+    pthread_mutex_destroy(&reclaimer->lock);
+
+    return -1;
+  }
+
+  if (pthread_create(&reclaimer->thread, NULL, reclaim, reclaimer) != 0) {
+    pthread_cond_destroy(&reclaimer->idle);
+    pthread_cond_destroy(&reclaimer->pending_ready);
+    pthread_mutex_destroy(&reclaimer->lock);
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Destroys a node reclaimer once its thread has freed every node submitted.
+ *
+ * No linked list may still be using the reclaimer.
+ * 
+ * @param reclaimer The node reclaimer to destroy.
+ * @return 0 on success, -1 on failure.
+ */
+int node_reclaimer_destroy(node_reclaimer_t *reclaimer) {
+  assert(reclaimer);
+
+  pthread_mutex_lock(&reclaimer->lock);
+  reclaimer->stopping = true;
+  pthread_cond_signal(&reclaimer->pending_ready);
+  pthread_mutex_unlock(&reclaimer->lock);
+
+  if (pthread_join(reclaimer->thread, NULL) != 0) {
+    return -1;
+  }
+
+  pthread_cond_destroy(&reclaimer->idle);
+  pthread_cond_destroy(&reclaimer->pending_ready);
+  pthread_mutex_destroy(&reclaimer->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Hands a chain of malloc'd nodes linked through next to the reclaimer thread to be freed.
+ *
+ * Constant time, the chain is prepended to those pending under the reclaimer's lock.
+ * 
+ * @param reclaimer The node reclaimer.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ * @return 0 on success, -1 on failure.
+ */
+int node_reclaimer_submit(node_reclaimer_t *reclaimer, node_t *first, node_t *last) {
+  assert(reclaimer);
+  assert(first);
+  assert(last);
+
+  pthread_mutex_lock(&reclaimer->lock);
+
+  last->next = reclaimer->pending;
+  reclaimer->pending = first;
+  reclaimer->submitted++;
+
+  pthread_cond_signal(&reclaimer->pending_ready);
+  pthread_mutex_unlock(&reclaimer->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Waits until every chain submitted so far has been freed.
+ * 
+ * @param reclaimer The node reclaimer.
+ * @return 0 on success, -1 on failure.
+ */
+int node_reclaimer_wait(node_reclaimer_t *reclaimer) {
+  assert(reclaimer);
+
+  pthread_mutex_lock(&reclaimer->lock);
+
+  size_t target = reclaimer->submitted;
+
+  while (reclaimer->reclaimed < target) {
+    pthread_cond_wait(&reclaimer->idle, &reclaimer->lock);
+  }
+
+  pthread_mutex_unlock(&reclaimer->lock);
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function run by the reclaimer thread, freeing pending chains until stopped.
+ * 
+ * @param reclaimer The node reclaimer.
+ * @return NULL.
+ */
+void* reclaim(void* reclaimer) {
+  node_reclaimer_t* self = reclaimer;
+
+  pthread_mutex_lock(&self->lock);
+
+  while (true) {
+    while (self->pending == NULL && !self->stopping) {
+      pthread_cond_wait(&self->pending_ready, &self->lock);
+    }
+
+    if (self->pending == NULL) {
+      break;
+    }
+
+    node_t* node = self->pending;
+    size_t taken = self->submitted;
+    size_t freed = 0;
+
+    self->pending = NULL;
+
+    pthread_mutex_unlock(&self->lock);
+
+    while (node != NULL) {
+      node_t* next = node->next;
+      free(node);
+      node = next;
+      freed++;
+    }
+
+    pthread_mutex_lock(&self->lock);
+
+    self->reclaimed = taken;
+    self->freed += freed;
+
+    pthread_cond_broadcast(&self->idle);
+  }
+
+  pthread_mutex_unlock(&self->lock);
+
+  return NULL;
+}
@@ -0,0 +1,192 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "scds/sharded_bag.h"
+
+#define SHARDED_BAG_DEFAULT_SHARDS 16
+
+static sharded_bag_shard_t* own_shard(sharded_bag_t* bag);
+
+static size_t next_thread = 0;
+static _Thread_local size_t thread_shard = SIZE_MAX;
+
+/**
+ * @brief Initializes a sharded bag.
+ * 
+ * @param bag The sharded bag to initialize.
+ * @param shards The number of shards, 0 for one per online processor.
+ * @return 0 on success, -1 on failure.
+ */
+int sharded_bag_init(sharded_bag_t *bag, size_t shards) {
+  assert(bag);
+
+  if (shards == 0) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    shards = processors > 0 ? (size_t) processors : SHARDED_BAG_DEFAULT_SHARDS;
+  }
+
+  bag->shards = NULL;
+  bag->count = 0;
+
+  if ((bag->shards = aligned_alloc(SHARDED_BAG_CACHE_LINE, shards * sizeof(sharded_bag_shard_t))) == NULL) {
+    return -1;
+  }
+
+  for (size_t i = 0; i < shards; i++) {
+    if (pthread_mutex_init(&bag->shards[i].lock, NULL) != 0) {
+      sharded_bag_destroy(bag);
+
+      return -1;
+    }
+
+    linked_list_init(&bag->shards[i].list);
+    bag->shards[i].size = 0;
+    bag->count++;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Destroys a sharded bag and the nodes it still holds.
+ *
+ * No other thread may be using the bag.
+ * 
+ * @param bag The sharded bag to destroy.
+ * @return 0 on success, -1 on failure.
+ */
+int sharded_bag_destroy(sharded_bag_t *bag) {
+  assert(bag);
+
+  for (size_t i = 0; i < bag->count; i++) {
+    linked_list_destroy(&bag->shards[i].list);
+    pthread_mutex_destroy(&bag->shards[i].lock);
+  }
+
+  free(bag->shards);
+
+  bag->shards = NULL;
+  bag->count = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Inserts data into the calling thread's shard of a sharded bag.
+ *
+ * Threads are spread over the shards round robin, so the shard's lock is uncontended
+ * while there are no more inserting threads than shards.
+ * 
+ * @param bag The sharded bag to insert into.
+ * @param data The data to insert.
+ * @return 0 on success, -1 on failure.
+ */
+int sharded_bag_insert(sharded_bag_t *bag, void *data) {
+  assert(bag);
+  assert(data);
+
+  sharded_bag_shard_t* shard = own_shard(bag);
+  int result = 0;
+
+  pthread_mutex_lock(&shard->lock);
+
+  if ((result = linked_list_insert(&shard->list, data)) == 0) {
+    __atomic_store_n(&shard->size, shard->list.size, __ATOMIC_RELAXED);
+  }
+
+  pthread_mutex_unlock(&shard->lock);
+
+  return result;
+}
+
+/**
+ * @brief Gets the number of items in a sharded bag without locking, approximate while it is inserted into.
+ * 
+ * @param bag The sharded bag.
+ * @return The number of items.
+ */
+size_t sharded_bag_size(const sharded_bag_t *bag) {
+  assert(bag);
+
+  size_t size = 0;
+
+  for (size_t i = 0; i < bag->count; i++) {
+    size += __atomic_load_n(&bag->shards[i].size, __ATOMIC_RELAXED);
+  }
+
+  return size;
+}
+
+/**
+ * @brief Moves every item of a sharded bag onto the end of a linked list, shard by shard.
+ *
+ * Each shard is spliced in constant time into an unpooled list of data pointers, see
+ * linked_list_splice. Inserts may continue meanwhile, landing in this or a later collect.
+ * 
+ * @param bag The sharded bag to empty.
+ * @param dest The linked list to append to.
+ * @return 0 on success, -1 on failure.
+ */
+int sharded_bag_collect(sharded_bag_t *bag, linked_list_t *dest) {
+  assert(bag);
+  assert(dest);
+
+  int result = 0;
+
+  for (size_t i = 0; i < bag->count && result == 0; i++) {
+    sharded_bag_shard_t* shard = &bag->shards[i];
+
+    pthread_mutex_lock(&shard->lock);
+
+    result = linked_list_splice(dest, &shard->list);
+
+    __atomic_store_n(&shard->size, shard->list.size, __ATOMIC_RELAXED);
+
+    pthread_mutex_unlock(&shard->lock);
+  }
+
+  return result;
+}
+
+/**
+ * @brief Module internal function to get the calling thread's shard, assigning one on first use.
+ * 
+ * @param bag The sharded bag.
+ * @return The shard.
+ */
+sharded_bag_shard_t* own_shard(sharded_bag_t* bag) {
+  assert(bag);
+  assert(bag->count > 0);
+
+  if (thread_shard == SIZE_MAX) {
+    thread_shard = __atomic_fetch_add(&next_thread, 1, __ATOMIC_RELAXED);
+  }
+
+  return &bag->shards[thread_shard % bag->count];
+}
@@ -0,0 +1,583 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "scds/unrolled_list.h"
+#include "comparator.h"
+
+_Static_assert(sizeof(unrolled_block_t) % UNROLLED_BLOCK_ALIGNMENT == 0, "unrolled_block_t must fill whole cache lines");
+
+static unrolled_block_t* append_block(unrolled_list_t* list);
+static void unlink_block(unrolled_list_t* list, unrolled_block_t* block);
+static size_t find_slot(const unrolled_block_t* block, const void* data);
+static int filter(unrolled_list_t* list, unrolled_list_t* dest, void* data, bool (*predicate)(void *, void*));
+static void truncate_after(unrolled_list_t* list, unrolled_block_t* block, size_t count);
+static int sort_items(unrolled_list_t* list, const comparator_t* comparator);
+static void merge_sort(void** items, void** scratch, size_t count, const comparator_t* comparator);
+
+/**
+ * @brief Create a new unrolled list.
+ *
+ * @return A pointer to the newly created unrolled list.
+ */
+unrolled_list_t* unrolled_list_new() {
+  unrolled_list_t* list = malloc(sizeof(unrolled_list_t));
+
+  unrolled_list_init(list);
+
+  return list;
+}
+
+/**
+ * @brief Frees an allocated unrolled list.
+ *
+ * @param list The unrolled list to free.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_free(unrolled_list_t *list) {
+  assert(list);
+
+  unrolled_list_destroy(list);
+
+  free(list);
+
+  return 0;
+}
+
+/**
+ * @brief Initializes an unrolled list.
+ *
+ * @param list The unrolled list to initialize.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_init(unrolled_list_t *list) {
+  assert(list);
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Destroys an unrolled list.
+ *
+ * @param list The unrolled list to destroy.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_destroy(unrolled_list_t *list) {
+  assert(list);
+
+  unrolled_list_clear(list);
+
+  return 0;
+}
+
+/**
+ * @brief Inserts data at the end of an unrolled list.
+ *
+ * @param list The unrolled list to insert into.
+ * @param data The data to insert.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_insert(unrolled_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  unrolled_block_t* block = list->tail;
+
+  if (block == NULL || block->count == UNROLLED_BLOCK_SLOTS) {
+    if ((block = append_block(list)) == NULL) {
+      return -1;
+    }
+  }
+
+  block->slots[block->count++] = data;
+  list->size++;
+
+  return 0;
+}
+
+/**
+ * @brief Removes the first occurrence of data from an unrolled list.
+ *
+ * A block left less than half full is merged into its successor when they fit together.
+ *
+ * @param list The unrolled list to remove from.
+ * @param data The data to remove.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_remove(unrolled_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  for (unrolled_block_t* block = list->head; block != NULL; block = block->next) {
+    size_t slot = find_slot(block, data);
+
+    if (slot == block->count) {
+      continue;
+    }
+
+    memmove(&block->slots[slot], &block->slots[slot + 1], (block->count - slot - 1) * sizeof(void*));
+    block->count--;
+    list->size--;
+
+    unrolled_block_t* next = block->next;
+
+    if (block->count == 0) {
+      unlink_block(list, block);
+    } else if (block->count < UNROLLED_BLOCK_SLOTS / 2 && next != NULL && block->count + next->count <= UNROLLED_BLOCK_SLOTS) {
+      memcpy(&block->slots[block->count], next->slots, next->count * sizeof(void*));
+      block->count += next->count;
+
+      unlink_block(list, next);
+    }
+
+    return 0;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Checks whether an unrolled list holds the given data.
+ *
+ * @param list The unrolled list to search.
+ * @param data The data to find.
+ * @return true if the data is held by the list, false otherwise.
+ */
+bool unrolled_list_contains(unrolled_list_t *list, void *data) {
+  assert(list);
+  assert(data);
+
+  for (unrolled_block_t* block = list->head; block != NULL; block = block->next) {
+    if (find_slot(block, data) != block->count) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Removes data from an unrolled list that matches a given predicate.
+ *
+ * @param list The unrolled list to remove from.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_remove_if(unrolled_list_t *list, void *data, bool (*predicate)(void *, void *)) {
+  assert(list);
+  assert(predicate);
+
+  return filter(list, NULL, data, predicate);
+}
+
+/**
+ * @brief Transfer data from one unrolled list to another when the predicate is true.
+ *
+ * @param list The unrolled list to remove from.
+ * @param dest The unrolled list to transfer to.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_steal_if(unrolled_list_t *list, unrolled_list_t *dest, void *data, bool (*predicate)(void *, void *)) {
+  assert(list);
+  assert(dest);
+  assert(list != dest);
+  assert(predicate);
+
+  return filter(list, dest, data, predicate);
+}
+
+/**
+ * @brief Sorts data in an unrolled list by a given comparator.
+ *
+ * The data is sorted in a contiguous array with a stable merge sort and written back
+ * into fully packed blocks.
+ *
+ * @param list The unrolled list to sort.
+ * @param compare The comparator to use.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_sort(unrolled_list_t *list, compare_func_t compare) {
+  assert(compare);
+
+  comparator_t comparator = { compare, NULL, NULL };
+
+  return sort_items(list, &comparator);
+}
+
+/**
+ * @brief Sorts data in an unrolled list by a given comparator taking a user context.
+ *
+ * Behaves as unrolled_list_sort, passing ctx to every comparison.
+ *
+ * @param list The unrolled list to sort.
+ * @param compare The comparator to use.
+ * @param ctx The context passed to the comparator.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_sort_r(unrolled_list_t *list, compare_r_func_t compare, void *ctx) {
+  assert(compare);
+
+  comparator_t comparator = { NULL, compare, ctx };
+
+  return sort_items(list, &comparator);
+}
+
+/**
+ * @brief Clears an unrolled list.
+ *
+ * @param list The unrolled list to clear.
+ * @return 0 on success, -1 on failure.
+ */
+int unrolled_list_clear(unrolled_list_t *list) {
+  assert(list);
+
+  unrolled_block_t* block = list->head;
+
+  while (block != NULL) {
+    unrolled_block_t* next = block->next;
+    free(block);
+    block = next;
+  }
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to allocate an empty block at the end of the list.
+ *
+ * @param list The unrolled list to add the block to.
+ * @return The new block or NULL on failure.
+ */
+unrolled_block_t* append_block(unrolled_list_t* list) {
+  assert(list);
+
+  unrolled_block_t* block = NULL;
+
+  if ((block = aligned_alloc(UNROLLED_BLOCK_ALIGNMENT, sizeof(unrolled_block_t))) == NULL) {
+    return NULL;
+  }
+
+  block->count = 0;
+  block->next = NULL;
+  block->prev = list->tail;
+
+  if (list->tail != NULL) {
+    list->tail->next = block;
+  } else {
+    list->head = block;
+  }
+
+  list->tail = block;
+
+  return block;
+}
+
+/**
+ * @brief Module internal function to unlink and free a block, its data isn't counted.
+ *
+ * @param list The unrolled list holding the block.
+ * @param block The block to unlink.
+ */
+void unlink_block(unrolled_list_t* list, unrolled_block_t* block) {
+  assert(list);
+  assert(block);
+
+  if (block->prev != NULL) {
+    block->prev->next = block->next;
+  } else {
+    list->head = block->next;
+  }
+
+  if (block->next != NULL) {
+    block->next->prev = block->prev;
+  } else {
+    list->tail = block->prev;
+  }
+
+  free(block);
+}
+
+/**
+ * @brief Module internal function to find the first slot in a block holding data.
+ *
+ * Slots are compared several at a time with SIMD instructions where available.
+ *
+ * @param block The block to search.
+ * @param data The data to find.
+ * @return The slot holding data or the count of the block if there is none.
+ */
+size_t find_slot(const unrolled_block_t* block, const void* data) {
+  assert(block);
+
+  size_t count = block->count;
+  size_t slot = 0;
+
+#if UINTPTR_MAX == UINT64_MAX && defined(__AVX2__)
+  __m256i needle = _mm256_set1_epi64x((long long) (uintptr_t) data);
+
+  for (; slot + 4 <= count; slot += 4) {
+    __m256i slots = _mm256_loadu_si256((const __m256i*) &block->slots[slot]);
+    int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(slots, needle)));
+
+    if (mask != 0) {
+      while ((mask & 1) == 0) {
+        mask >>= 1;
+        slot++;
+      }
+
+      return slot;
+    }
+  }
+#elif UINTPTR_MAX == UINT64_MAX && defined(__SSE2__)
+  __m128i needle = _mm_set1_epi64x((long long) (uintptr_t) data);
+
+  for (; slot + 2 <= count; slot += 2) {
+    __m128i halves = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) &block->slots[slot]), needle);
+    __m128i equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    int mask = _mm_movemask_pd(_mm_castsi128_pd(equal));
+
+    if (mask != 0) {
+      return (mask & 1) != 0 ? slot : slot + 1;
+    }
+  }
+#elif UINTPTR_MAX == UINT64_MAX && defined(__ARM_NEON) && defined(__aarch64__)
+  uint64x2_t needle = vdupq_n_u64((uint64_t) (uintptr_t) data);
+
+  for (; slot + 2 <= count; slot += 2) {
+    uint64x2_t equal = vceqq_u64(vld1q_u64((const uint64_t*) &block->slots[slot]), needle);
+
+    if ((vgetq_lane_u64(equal, 0) | vgetq_lane_u64(equal, 1)) != 0) {
+      return vgetq_lane_u64(equal, 0) != 0 ? slot : slot + 1;
+    }
+  }
+#endif
+
+  for (; slot < count; slot++) {
+    if (block->slots[slot] == data) {
+      return slot;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * @brief Module internal function to remove or transfer matching data, packing the blocks.
+ *
+ * Data that is kept is written back in order behind the read position so the surviving
+ * blocks end up full. Data that can't be transferred is kept and reported as a failure.
+ *
+ * @param list The unrolled list to filter.
+ * @param dest The unrolled list to transfer matches to, NULL to discard them.
+ * @param data Contextual data for the predicate.
+ * @param predicate The predicate to use.
+ * @return 0 on success, -1 on failure.
+ */
+int filter(unrolled_list_t* list, unrolled_list_t* dest, void* data, bool (*predicate)(void *, void*)) {
+  assert(list);
+  assert(list != dest);
+  assert(predicate);
+
+  if (list->head == NULL) {
+    return 0;
+  }
+
+  int result = 0;
+  unrolled_block_t* write_block = list->head;
+  size_t write_slot = 0;
+  size_t kept = 0;
+
+  for (unrolled_block_t* block = list->head; block != NULL; block = block->next) {
+    size_t count = block->count;
+
+    for (size_t slot = 0; slot < count; slot++) {
+      void* item = block->slots[slot];
+
+      if (predicate(item, data)) {
+        if (dest == NULL) {
+          continue;
+        }
+
+        if (unrolled_list_insert(dest, item) == 0) {
+          continue;
+        }
+
+        result = -1;
+      }
+
+      if (write_slot == UNROLLED_BLOCK_SLOTS) {
+        write_block->count = UNROLLED_BLOCK_SLOTS;
+        write_block = write_block->next;
+        write_slot = 0;
+      }
+
+      write_block->slots[write_slot++] = item;
+      kept++;
+    }
+  }
+
+  truncate_after(list, write_block, write_slot);
+
+  list->size = kept;
+
+  return result;
+}
+
+/**
+ * @brief Module internal function to drop every block after the given one.
+ *
+ * @param list The unrolled list to truncate.
+ * @param block The last block to keep.
+ * @param count The number of slots in use in that block, 0 drops it as well.
+ */
+void truncate_after(unrolled_list_t* list, unrolled_block_t* block, size_t count) {
+  assert(list);
+  assert(block);
+
+  block->count = count;
+
+  while (list->tail != block) {
+    unlink_block(list, list->tail);
+  }
+
+  if (count == 0) {
+    unlink_block(list, block);
+  }
+}
+
+/**
+ * @brief Module internal function to sort data in an unrolled list through a contiguous array.
+ *
+ * @param list The unrolled list to sort.
+ * @param comparator The comparator to use.
+ * @return 0 on success, -1 on failure.
+ */
+int sort_items(unrolled_list_t* list, const comparator_t* comparator) {
+  assert(list);
+  assert(comparator);
+
+  if (list->size <= 1) {
+    return 0;
+  }
+
+  void** items = NULL;
+
+  if ((items = malloc(list->size * 2 * sizeof(void*))) == NULL) {
+    return -1;
+  }
+
+  size_t count = 0;
+
+  for (unrolled_block_t* block = list->head; block != NULL; block = block->next) {
+    memcpy(&items[count], block->slots, block->count * sizeof(void*));
+    count += block->count;
+  }
+
+  merge_sort(items, items + count, count, comparator);
+
+  unrolled_block_t* block = list->head;
+  size_t written = 0;
+
+  while (written < count) {
+    size_t chunk = count - written < UNROLLED_BLOCK_SLOTS ? count - written : UNROLLED_BLOCK_SLOTS;
+
+    memcpy(block->slots, &items[written], chunk * sizeof(void*));
+    block->count = chunk;
+    written += chunk;
+
+    if (written < count) {
+      block = block->next;
+    }
+  }
+
+  truncate_after(list, block, block->count);
+
+  free(items);
+
+  return 0;
+}
+
+/**
+ * @brief Module internal function to stably sort an array with a bottom-up merge sort.
+ *
+ * @param items The array to sort.
+ * @param scratch An array of the same length to merge through.
+ * @param count The number of items.
+ * @param comparator The comparator to use.
+ */
+void merge_sort(void** items, void** scratch, size_t count, const comparator_t* comparator) {
+  void** from = items;
+  void** to = scratch;
+
+  for (size_t width = 1; width < count; width *= 2) {
+    for (size_t start = 0; start < count; start += width * 2) {
+      size_t middle = start + width < count ? start + width : count;
+      size_t end = middle + width < count ? middle + width : count;
+      size_t left = start;
+      size_t right = middle;
+      size_t out = start;
+
+      while (left < middle && right < end) {
+        to[out++] = comparator_compare(comparator, from[left], from[right]) <= 0 ? from[left++] : from[right++];
+      }
+
+      while (left < middle) {
+        to[out++] = from[left++];
+      }
+
+      while (right < end) {
+        to[out++] = from[right++];
+      }
+    }
+
+    void** swap = from;
+    from = to;
+    to = swap;
+  }
+
+  if (from != items) {
+    memcpy(items, from, count * sizeof(void*));
+  }
+}
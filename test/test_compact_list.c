@@ -0,0 +1,237 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <unity.h>
+
+#include <scds/compact_list.h>
+
+static int compare_int_descending(const void *a, const void *b);
+static bool is_not_equal_to_x(void* value, void* x);
+static int compare_int_in_direction(const void *a, const void *b, void *direction);
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_compact_list_WHEN_init_THEN_compact_list_in_initialised_state() {
+    compact_list_t list;
+    compact_list_init(&list);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_EQUAL(COMPACT_LIST_NIL, list.head);
+    TEST_ASSERT_EQUAL(COMPACT_LIST_NIL, list.tail);
+    TEST_ASSERT_NULL(list.nodes);
+}
+
+void test_GIVEN_compact_list_WHEN_insert_and_remove_THEN_slots_are_reused() {
+    compact_list_t list;
+    compact_list_init(&list);
+
+    int data1 = 1;
+    int data2 = 2;
+    int data3 = 3;
+
+    compact_list_insert(&list, &data1);
+    compact_list_insert(&list, &data2);
+    compact_list_remove(&list, &data1);
+    compact_list_insert(&list, &data3);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL(2, list.used);
+    TEST_ASSERT_EQUAL(2, *(int*)list.nodes[list.head].data);
+    TEST_ASSERT_EQUAL(3, *(int*)list.nodes[list.tail].data);
+    TEST_ASSERT_FALSE(compact_list_contains(&list, &data1));
+    TEST_ASSERT_EQUAL(-1, compact_list_remove(&list, &data1));
+
+    compact_list_destroy(&list);
+}
+
+void test_GIVEN_compact_list_WHEN_clear_THEN_list_is_empty_and_keeps_capacity() {
+    compact_list_t list;
+    compact_list_init(&list);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        compact_list_insert(&list, &values[i]);
+    }
+
+    uint32_t capacity = list.capacity;
+
+    compact_list_clear(&list);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_EQUAL(COMPACT_LIST_NIL, list.head);
+    TEST_ASSERT_EQUAL(COMPACT_LIST_NIL, list.tail);
+    TEST_ASSERT_EQUAL(capacity, list.capacity);
+
+    compact_list_insert(&list, &values[0]);
+
+    TEST_ASSERT_EQUAL(0, list.head);
+
+    compact_list_destroy(&list);
+}
+
+void test_GIVEN_compact_list_WHEN_steal_and_steal_if_THEN_data_is_moved() {
+    compact_list_t list;
+    compact_list_init(&list);
+
+    compact_list_t dest;
+    compact_list_init(&dest);
+
+    int data1 = 1;
+    int data2 = 2;
+    int data3 = 3;
+
+    compact_list_insert(&list, &data1);
+    compact_list_insert(&list, &data2);
+    compact_list_insert(&list, &data3);
+
+    compact_list_steal(&list, &dest, 1);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL(1, dest.size);
+    TEST_ASSERT_EQUAL(2, *(int*)dest.nodes[dest.head].data);
+
+    int x = 3;
+    compact_list_steal_if(&list, &dest, &x, is_not_equal_to_x);
+
+    TEST_ASSERT_EQUAL(1, list.size);
+    TEST_ASSERT_EQUAL(3, *(int*)list.nodes[list.head].data);
+    TEST_ASSERT_EQUAL(2, dest.size);
+    TEST_ASSERT_EQUAL(1, *(int*)dest.nodes[dest.tail].data);
+
+    compact_list_remove_if(&dest, &x, is_not_equal_to_x);
+
+    TEST_ASSERT_EQUAL(0, dest.size);
+
+    compact_list_destroy(&list);
+    compact_list_destroy(&dest);
+}
+
+void test_GIVEN_compact_list_WHEN_sort_THEN_list_is_sorted() {
+    compact_list_t list;
+    compact_list_init(&list);
+
+    int values[5] = { 153, 23, 57, 92, 209 };
+
+    for (size_t i = 0; i < 5; i++) {
+        compact_list_insert(&list, &values[i]);
+    }
+
+    compact_list_sort(&list, compare_int_descending);
+
+    int expected[5] = { 209, 153, 92, 57, 23 };
+    uint32_t prev = COMPACT_LIST_NIL;
+    size_t i = 0;
+
+    for (uint32_t index = list.head; index != COMPACT_LIST_NIL; index = list.nodes[index].next) {
+        TEST_ASSERT_EQUAL(prev, list.nodes[index].prev);
+        TEST_ASSERT_EQUAL(expected[i++], *(int*)list.nodes[index].data);
+        prev = index;
+    }
+
+    TEST_ASSERT_EQUAL(5, i);
+    TEST_ASSERT_EQUAL(prev, list.tail);
+
+    compact_list_destroy(&list);
+}
+
+void test_GIVEN_compact_list_WHEN_sort_r_THEN_list_is_sorted_in_context_direction() {
+    compact_list_t list;
+    compact_list_init(&list);
+
+    int values[5] = { 57, 23, 209, 92, 153 };
+
+    for (size_t i = 0; i < 5; i++) {
+        compact_list_insert(&list, &values[i]);
+    }
+
+    int directions[2] = { 1, -1 };
+    int expected[2][5] = { { 23, 57, 92, 153, 209 }, { 209, 153, 92, 57, 23 } };
+
+    for (size_t d = 0; d < 2; d++) {
+        TEST_ASSERT_EQUAL(0, compact_list_sort_r(&list, compare_int_in_direction, &directions[d]));
+
+        uint32_t prev = COMPACT_LIST_NIL;
+        size_t i = 0;
+
+        for (uint32_t index = list.head; index != COMPACT_LIST_NIL; index = list.nodes[index].next) {
+            TEST_ASSERT_EQUAL(prev, list.nodes[index].prev);
+            TEST_ASSERT_EQUAL(expected[d][i++], *(int*)list.nodes[index].data);
+            prev = index;
+        }
+
+        TEST_ASSERT_EQUAL(5, i);
+        TEST_ASSERT_EQUAL(prev, list.tail);
+    }
+
+    compact_list_destroy(&list);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_compact_list_WHEN_init_THEN_compact_list_in_initialised_state);
+    RUN_TEST(test_GIVEN_compact_list_WHEN_insert_and_remove_THEN_slots_are_reused);
+    RUN_TEST(test_GIVEN_compact_list_WHEN_clear_THEN_list_is_empty_and_keeps_capacity);
+    RUN_TEST(test_GIVEN_compact_list_WHEN_steal_and_steal_if_THEN_data_is_moved);
+    RUN_TEST(test_GIVEN_compact_list_WHEN_sort_THEN_list_is_sorted);
+    RUN_TEST(test_GIVEN_compact_list_WHEN_sort_r_THEN_list_is_sorted_in_context_direction);
+
+    return UNITY_END();
+}
+
+bool is_not_equal_to_x(void* value, void* x) {
+    return *(int*)value != *(int*)x;
+}
+
+int compare_int_descending(const void *a, const void *b) {
+    int x = *(int*)a;
+    int y = *(int*)b;
+
+    if (x < y) {
+        return 1;
+    }
+
+    if (x > y) {
+        return -1;
+    }
+
+    return 0;
+}
+
+int compare_int_in_direction(const void *a, const void *b, void *direction) {
+    int x = *(int*)a;
+    int y = *(int*)b;
+
+    if (x < y) {
+        return -*(int*)direction;
+    }
+
+    if (x > y) {
+        return *(int*)direction;
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <unity.h>
+
+#include <scds/concurrent_list.h>
+
+#define READERS 3
+#define ROUNDS 20000
+
+typedef struct shared {
+    concurrent_list_t *list;
+    int stop;
+    size_t visits;
+} shared_t;
+
+static bool is_odd(void* value, void* x);
+static bool count_value(void* value, void* count);
+static void* read_repeatedly(void* arg);
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_concurrent_list_WHEN_insert_and_remove_THEN_readers_see_the_changes() {
+    concurrent_list_t list;
+    concurrent_list_init(&list);
+
+    concurrent_reader_t reader;
+    concurrent_list_register(&list, &reader);
+
+    int values[6] = { 1, 2, 3, 4, 5, 6 };
+
+    for (size_t i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL(0, concurrent_list_insert(&list, &values[i]));
+    }
+
+    TEST_ASSERT_EQUAL(6, concurrent_list_size(&list));
+    TEST_ASSERT_TRUE(concurrent_list_contains(&list, &reader, &values[2]));
+
+    // A node removed while a read section is on it stays valid until the section ends.
+    concurrent_list_read_lock(&list, &reader);
+
+    concurrent_node_t* node = concurrent_list_first(&list);
+
+    TEST_ASSERT_EQUAL(0, concurrent_list_remove(&list, &values[0]));
+    TEST_ASSERT_EQUAL_PTR(&values[0], node->data);
+    TEST_ASSERT_EQUAL_PTR(&values[1], concurrent_list_next(node)->data);
+    TEST_ASSERT_NOT_NULL(list.retired_head);
+
+    concurrent_list_read_unlock(&reader);
+    concurrent_list_reclaim(&list);
+
+    TEST_ASSERT_NULL(list.retired_head);
+    TEST_ASSERT_FALSE(concurrent_list_contains(&list, &reader, &values[0]));
+    TEST_ASSERT_EQUAL(-1, concurrent_list_remove(&list, &values[0]));
+
+    concurrent_list_t dest;
+    concurrent_list_init(&dest);
+
+    TEST_ASSERT_EQUAL(0, concurrent_list_steal_if(&list, &dest, NULL, is_odd));
+    TEST_ASSERT_EQUAL(3, concurrent_list_size(&list));
+    TEST_ASSERT_EQUAL(2, concurrent_list_size(&dest));
+    TEST_ASSERT_EQUAL_PTR(&values[2], dest.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[4], dest.tail->data);
+    TEST_ASSERT_EQUAL_PTR(&values[5], list.tail->data);
+
+    size_t count = 0;
+
+    concurrent_list_for_each(&list, &reader, &count, count_value);
+
+    TEST_ASSERT_EQUAL(3, count);
+
+    TEST_ASSERT_EQUAL(0, concurrent_list_clear(&list));
+    TEST_ASSERT_EQUAL(0, concurrent_list_size(&list));
+    TEST_ASSERT_NULL(concurrent_list_first(&list));
+
+    concurrent_list_unregister(&list, &reader);
+    concurrent_list_destroy(&list);
+    concurrent_list_destroy(&dest);
+}
+
+void test_GIVEN_concurrent_readers_WHEN_writer_inserts_and_removes_THEN_traversals_stay_valid() {
+    concurrent_list_t list;
+    concurrent_list_init(&list);
+
+    shared_t shared = { &list, 0, 0 };
+    pthread_t threads[READERS];
+    int* values = malloc(ROUNDS * sizeof(int));
+
+    for (size_t i = 0; i < READERS; i++) {
+        pthread_create(&threads[i], NULL, read_repeatedly, &shared);
+    }
+
+    for (size_t i = 0; i < ROUNDS; i++) {
+        values[i] = 1;
+        concurrent_list_insert(&list, &values[i]);
+
+        if (i >= 16) {
+            TEST_ASSERT_EQUAL(0, concurrent_list_remove(&list, &values[i - 16]));
+        }
+    }
+
+    __atomic_store_n(&shared.stop, 1, __ATOMIC_RELEASE);
+
+    for (size_t i = 0; i < READERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    concurrent_list_reclaim(&list);
+
+    TEST_ASSERT_EQUAL(16, concurrent_list_size(&list));
+    TEST_ASSERT_NULL(list.retired_head);
+    TEST_ASSERT_TRUE(__atomic_load_n(&shared.visits, __ATOMIC_RELAXED) > 0);
+
+    concurrent_list_destroy(&list);
+    free(values);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_concurrent_list_WHEN_insert_and_remove_THEN_readers_see_the_changes);
+    RUN_TEST(test_GIVEN_concurrent_readers_WHEN_writer_inserts_and_removes_THEN_traversals_stay_valid);
+
+    return UNITY_END();
+}
+
+bool is_odd(void* value, void* x) {
+    return *(int*)value % 2 != 0;
+}
+
+bool count_value(void* value, void* count) {
+    (*(size_t*)count)++;
+
+    return true;
+}
+
+void* read_repeatedly(void* arg) {
+    shared_t* shared = arg;
+    concurrent_reader_t reader;
+
+    concurrent_list_register(shared->list, &reader);
+
+    do {
+        size_t count = 0;
+
+        concurrent_list_for_each(shared->list, &reader, &count, count_value);
+
+        __atomic_add_fetch(&shared->visits, count, __ATOMIC_RELAXED);
+    } while (!__atomic_load_n(&shared->stop, __ATOMIC_ACQUIRE));
+
+    concurrent_list_unregister(shared->list, &reader);
+
+    return NULL;
+}
@@ -0,0 +1,171 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <unity.h>
+
+#include <scds/ilist.h>
+
+typedef struct item {
+    int value;
+    ilist_link_t link;
+} item_t;
+
+static bool is_not_equal_to_x(ilist_link_t* link, void* x);
+static void count_disposed(ilist_link_t* link);
+
+static int disposed = 0;
+
+void setUp(void) { disposed = 0; }
+void tearDown(void) { }
+
+void test_GIVEN_ilist_WHEN_init_THEN_ilist_in_initialised_state() {
+    ilist_t list;
+    ilist_init(&list);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_NULL(list.head);
+    TEST_ASSERT_NULL(list.tail);
+}
+
+void test_GIVEN_ilist_WHEN_insert_THEN_objects_are_linked() {
+    ilist_t list;
+    ilist_init(&list);
+
+    item_t item1 = { .value = 1 };
+    item_t item2 = { .value = 2 };
+
+    ilist_insert(&list, &item1.link);
+    ilist_insert(&list, &item2.link);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL_PTR(&item1, ilist_entry(list.head, item_t, link));
+    TEST_ASSERT_EQUAL_PTR(&item2, ilist_entry(list.tail, item_t, link));
+    TEST_ASSERT_EQUAL(2, ilist_entry(list.head->next, item_t, link)->value);
+}
+
+void test_GIVEN_ilist_WHEN_remove_THEN_object_is_unlinked() {
+    ilist_t list;
+    ilist_init(&list);
+
+    item_t item1 = { .value = 1 };
+    item_t item2 = { .value = 2 };
+    item_t item3 = { .value = 3 };
+
+    ilist_insert(&list, &item1.link);
+    ilist_insert(&list, &item2.link);
+    ilist_insert(&list, &item3.link);
+
+    ilist_remove(&list, &item2.link);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL_PTR(&item3.link, list.head->next);
+    TEST_ASSERT_EQUAL_PTR(&item1.link, list.tail->prev);
+    TEST_ASSERT_NULL(item2.link.next);
+    TEST_ASSERT_NULL(item2.link.prev);
+}
+
+void test_GIVEN_ilist_WHEN_remove_if_THEN_remove_if_value_is_not_equal_to_x() {
+    ilist_t list;
+    ilist_init(&list);
+
+    item_t item1 = { .value = 1 };
+    item_t item2 = { .value = 2 };
+    item_t item3 = { .value = 3 };
+
+    ilist_insert(&list, &item1.link);
+    ilist_insert(&list, &item2.link);
+    ilist_insert(&list, &item3.link);
+
+    int x = 2;
+    ilist_remove_if(&list, &x, is_not_equal_to_x, count_disposed);
+
+    TEST_ASSERT_EQUAL(1, list.size);
+    TEST_ASSERT_EQUAL(2, disposed);
+    TEST_ASSERT_EQUAL_PTR(&item2.link, list.head);
+    TEST_ASSERT_EQUAL_PTR(&item2.link, list.tail);
+}
+
+void test_GIVEN_ilist_WHEN_steal_if_THEN_steal_if_value_is_not_equal_to_x() {
+    ilist_t list;
+    ilist_init(&list);
+
+    ilist_t dest;
+    ilist_init(&dest);
+
+    item_t item1 = { .value = 1 };
+    item_t item2 = { .value = 2 };
+    item_t item3 = { .value = 3 };
+
+    ilist_insert(&list, &item1.link);
+    ilist_insert(&list, &item2.link);
+    ilist_insert(&list, &item3.link);
+
+    int x = 2;
+    ilist_steal_if(&list, &dest, &x, is_not_equal_to_x);
+
+    TEST_ASSERT_EQUAL(1, list.size);
+    TEST_ASSERT_EQUAL_PTR(&item2.link, list.head);
+    TEST_ASSERT_EQUAL(2, dest.size);
+    TEST_ASSERT_EQUAL_PTR(&item1.link, dest.head);
+    TEST_ASSERT_EQUAL_PTR(&item3.link, dest.tail);
+}
+
+void test_GIVEN_ilist_WHEN_clear_THEN_ilist_is_empty() {
+    ilist_t list;
+    ilist_init(&list);
+
+    item_t item1 = { .value = 1 };
+    item_t item2 = { .value = 2 };
+
+    ilist_insert(&list, &item1.link);
+    ilist_insert(&list, &item2.link);
+
+    ilist_clear(&list, count_disposed);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_EQUAL(2, disposed);
+    TEST_ASSERT_NULL(list.head);
+    TEST_ASSERT_NULL(list.tail);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_ilist_WHEN_init_THEN_ilist_in_initialised_state);
+    RUN_TEST(test_GIVEN_ilist_WHEN_insert_THEN_objects_are_linked);
+    RUN_TEST(test_GIVEN_ilist_WHEN_remove_THEN_object_is_unlinked);
+    RUN_TEST(test_GIVEN_ilist_WHEN_remove_if_THEN_remove_if_value_is_not_equal_to_x);
+    RUN_TEST(test_GIVEN_ilist_WHEN_steal_if_THEN_steal_if_value_is_not_equal_to_x);
+    RUN_TEST(test_GIVEN_ilist_WHEN_clear_THEN_ilist_is_empty);
+
+    return UNITY_END();
+}
+
+bool is_not_equal_to_x(ilist_link_t* link, void* x) {
+    return ilist_entry(link, item_t, link)->value != *(int*)x;
+}
+
+void count_disposed(ilist_link_t* link) {
+    disposed++;
+}
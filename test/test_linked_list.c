@@ -22,12 +22,20 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stdlib.h>
+
 #include <unity.h>
 
 #include <scds/linked_list.h>
 
 static int compare_int_descending(const void *a, const void *b);
 static bool is_not_equal_to_x(void* value, void* x);
+static uint64_t int_key(const void *value);
+static uint64_t int_descending_prefix(const void *value);
+static int compare_int_in_direction(const void *a, const void *b, void *direction);
+static uint64_t int_key_in_direction(const void *value, void *direction);
+static void assert_sorted_in_direction(linked_list_t* list, int direction);
+static void assert_linked(linked_list_t* list);
 
 void setUp(void) { }
 void tearDown(void) { }
@@ -288,39 +296,1239 @@ void test_GIVEN_linked_list_WHEN_sort_THEN_list_is_sorted() {
     TEST_ASSERT_EQUAL(data2, *(int*)list.tail->data);
 }
 
-int main(int argc, char* argv[]) {
-    UNITY_BEGIN();
+void test_GIVEN_pooled_linked_list_WHEN_insert_and_remove_THEN_nodes_are_recycled() {
+    linked_list_t list;
+    linked_list_init_pooled(&list, 2);
 
-    RUN_TEST(test_GIVEN_linked_list_WHEN_new_THEN_memory_is_allocated_and_linked_list_is_initialised);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_init_THEN_linked_list_in_initialised_state);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_insert_THEN_node_is_inserted);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_insert_multiple_then_nodes_are_inserted);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_remove_THEN_node_is_removed);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_remove_multiple_THEN_nodes_are_removed);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_clear_THEN_list_is_empty);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_steal_THEN_node_is_moved);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_remove_if_THEN_remove_if_value_is_not_equal_to_x);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_steal_if_THEN_steal_if_value_is_not_equal_to_x);
-    RUN_TEST(test_GIVEN_linked_list_WHEN_sort_THEN_list_is_sorted);
+    int data1 = 1;
+    int data2 = 2;
+    int data3 = 3;
 
-    return UNITY_END();
+    linked_list_insert(&list, &data1);
+    linked_list_insert(&list, &data2);
+
+    node_t* recycled = list.tail;
+
+    linked_list_remove(&list, &data2);
+    linked_list_insert(&list, &data3);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL_PTR(recycled, list.tail);
+    TEST_ASSERT_EQUAL(1, *(int*)list.head->data);
+    TEST_ASSERT_EQUAL(3, *(int*)list.tail->data);
+
+    linked_list_clear(&list);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_NULL(list.head);
+    TEST_ASSERT_NULL(list.tail);
+
+    linked_list_insert(&list, &data1);
+
+    TEST_ASSERT_EQUAL(1, *(int*)list.head->data);
+
+    linked_list_destroy(&list);
+
+    TEST_ASSERT_NULL(list.pool);
 }
 
-bool is_not_equal_to_x(void* value, void* x) {
-    return *(int*)value != *(int*)x;
+void test_GIVEN_pooled_linked_list_WHEN_steal_to_unpooled_list_THEN_node_is_moved() {
+    linked_list_t list;
+    linked_list_init_pooled(&list, 0);
+
+    linked_list_t dest;
+    linked_list_init(&dest);
+
+    int data1 = 1;
+    int data2 = 2;
+
+    linked_list_insert(&list, &data1);
+    linked_list_insert(&list, &data2);
+
+    linked_list_steal(&list, &dest, 0);
+
+    TEST_ASSERT_EQUAL(1, list.size);
+    TEST_ASSERT_EQUAL(2, *(int*)list.head->data);
+    TEST_ASSERT_EQUAL(1, dest.size);
+    TEST_ASSERT_EQUAL(1, *(int*)dest.head->data);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
 }
 
-int compare_int_descending(const void *a, const void *b) {
-    int x = *(int*)a;
-    int y = *(int*)b;
+void test_GIVEN_large_reverse_sorted_linked_list_WHEN_sort_THEN_list_is_sorted_and_linked() {
+    linked_list_t list;
+    linked_list_init(&list);
 
-    if (x < y) {
-        return 1;
-    } 
-    
-    if (x > y) {
-        return -1;
+    size_t count = 300000;
+    int* values = malloc(count * sizeof(int));
+
+    for (size_t i = 0; i < count; i++) {
+        values[i] = (int) i;
+        linked_list_insert(&list, &values[i]);
     }
 
-    return 0;
+    linked_list_sort(&list, compare_int_descending);
+
+    TEST_ASSERT_EQUAL(count, list.size);
+    TEST_ASSERT_EQUAL((int) count - 1, *(int*)list.head->data);
+    TEST_ASSERT_EQUAL(0, *(int*)list.tail->data);
+    TEST_ASSERT_NULL(list.head->prev);
+    TEST_ASSERT_NULL(list.tail->next);
+
+    size_t seen = 0;
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        if (node->next != NULL) {
+            TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+            TEST_ASSERT_TRUE(*(int*)node->data > *(int*)node->next->data);
+        }
+
+        seen++;
+    }
+
+    TEST_ASSERT_EQUAL(count, seen);
+
+    linked_list_destroy(&list);
+    free(values);
+}
+
+void test_GIVEN_linked_list_with_equal_values_WHEN_sort_THEN_order_of_equal_values_is_kept() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    int values[] = { 1, 3, 1, 2, 3, 1 };
+
+    for (size_t i = 0; i < 6; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    linked_list_sort(&list, compare_int_descending);
+
+    int* expected[] = { &values[1], &values[4], &values[3], &values[0], &values[2], &values[5] };
+    size_t i = 0;
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL_PTR(expected[i++], node->data);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(&values[5], list.tail->data);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_indexed_linked_list_WHEN_remove_THEN_node_is_removed() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) i;
+        linked_list_insert(&list, &values[i]);
+    }
+
+    linked_list_enable_index(&list);
+
+    TEST_ASSERT_TRUE(linked_list_contains(&list, &values[50]));
+    TEST_ASSERT_EQUAL(0, linked_list_remove(&list, &values[50]));
+    TEST_ASSERT_FALSE(linked_list_contains(&list, &values[50]));
+    TEST_ASSERT_EQUAL(-1, linked_list_remove(&list, &values[50]));
+    TEST_ASSERT_EQUAL(0, linked_list_remove(&list, &values[0]));
+    TEST_ASSERT_EQUAL(0, linked_list_remove(&list, &values[99]));
+
+    TEST_ASSERT_EQUAL(97, list.size);
+    TEST_ASSERT_EQUAL(1, *(int*)list.head->data);
+    TEST_ASSERT_EQUAL(98, *(int*)list.tail->data);
+
+    for (size_t i = 1; i < 99; i++) {
+        TEST_ASSERT_EQUAL(i != 50, linked_list_contains(&list, &values[i]));
+    }
+
+    linked_list_destroy(&list);
+
+    TEST_ASSERT_NULL(list.index);
+}
+
+void test_GIVEN_indexed_linked_list_WHEN_steal_THEN_both_indexes_are_updated() {
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_index(&list);
+
+    linked_list_t dest;
+    linked_list_init(&dest);
+    linked_list_enable_index(&dest);
+
+    int values[40];
+
+    for (size_t i = 0; i < 40; i++) {
+        values[i] = (int) i;
+        linked_list_insert(&list, &values[i]);
+    }
+
+    int x = 7;
+    linked_list_steal_if(&list, &dest, &x, is_not_equal_to_x);
+
+    TEST_ASSERT_EQUAL(1, list.size);
+    TEST_ASSERT_EQUAL(39, dest.size);
+    TEST_ASSERT_TRUE(linked_list_contains(&list, &values[7]));
+    TEST_ASSERT_FALSE(linked_list_contains(&list, &values[8]));
+    TEST_ASSERT_TRUE(linked_list_contains(&dest, &values[8]));
+    TEST_ASSERT_FALSE(linked_list_contains(&dest, &values[7]));
+
+    linked_list_index_stats_t stats;
+
+    TEST_ASSERT_EQUAL(0, linked_list_index_stats(&dest, &stats));
+    TEST_ASSERT_EQUAL(39, stats.entries);
+    TEST_ASSERT_TRUE(stats.capacity >= 39);
+    TEST_ASSERT_TRUE(stats.rehashes > 0);
+    TEST_ASSERT_TRUE(stats.memory > 0);
+
+    linked_list_clear(&dest);
+
+    TEST_ASSERT_FALSE(linked_list_contains(&dest, &values[8]));
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+}
+
+void test_GIVEN_positioned_linked_list_WHEN_insert_at_THEN_data_is_at_position() {
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_positions(&list);
+
+    int values[5] = { 0, 1, 2, 3, 4 };
+
+    linked_list_insert(&list, &values[1]);
+    linked_list_insert(&list, &values[3]);
+    linked_list_insert_at(&list, 0, &values[0]);
+    linked_list_insert_at(&list, 2, &values[2]);
+    linked_list_insert_at(&list, 4, &values[4]);
+
+    TEST_ASSERT_EQUAL(5, list.size);
+    TEST_ASSERT_EQUAL(-1, linked_list_insert_at(&list, 6, &values[0]));
+
+    for (size_t i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_PTR(&values[i], linked_list_at(&list, i));
+    }
+
+    TEST_ASSERT_NULL(linked_list_at(&list, 5));
+    TEST_ASSERT_EQUAL_PTR(&values[0], list.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[4], list.tail->data);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_positioned_linked_list_WHEN_steal_in_loop_THEN_nodes_are_moved() {
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_positions(&list);
+
+    linked_list_t dest;
+    linked_list_init(&dest);
+
+    int values[1000];
+
+    for (size_t i = 0; i < 1000; i++) {
+        values[i] = (int) i;
+        linked_list_insert(&list, &values[i]);
+    }
+
+    while (list.size > 1) {
+        linked_list_steal(&list, &dest, list.size / 2);
+    }
+
+    TEST_ASSERT_EQUAL(1, list.size);
+    TEST_ASSERT_EQUAL(999, dest.size);
+    TEST_ASSERT_EQUAL(0, *(int*)list.head->data);
+    TEST_ASSERT_EQUAL(500, *(int*)dest.head->data);
+    TEST_ASSERT_EQUAL(999, *(int*)dest.tail->data);
+
+    int x = 3;
+    linked_list_remove_if(&dest, &x, is_not_equal_to_x);
+    linked_list_insert(&list, &values[1]);
+    linked_list_steal(&dest, &list, 0);
+
+    TEST_ASSERT_EQUAL_PTR(&values[3], linked_list_at(&list, 2));
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+}
+
+void test_GIVEN_linked_list_WHEN_insert_many_THEN_nodes_are_inserted_in_order() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    int values[5] = { 0, 1, 2, 3, 4 };
+    void* items[5] = { &values[0], &values[1], &values[2], &values[3], &values[4] };
+
+    linked_list_insert(&list, &values[0]);
+    linked_list_insert_many(&list, &items[1], 4);
+
+    TEST_ASSERT_EQUAL(5, list.size);
+
+    size_t i = 0;
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL_PTR(items[i], node->data);
+
+        if (node->next != NULL) {
+            TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+        }
+
+        i++;
+    }
+
+    TEST_ASSERT_EQUAL(5, i);
+    TEST_ASSERT_EQUAL_PTR(&values[4], list.tail->data);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_pooled_linked_list_WHEN_extend_THEN_data_is_copied_from_source() {
+    linked_list_t list;
+    linked_list_init_pooled(&list, 4);
+    linked_list_enable_index(&list);
+
+    linked_list_t source;
+    linked_list_init(&source);
+
+    int values[10];
+
+    for (size_t i = 0; i < 10; i++) {
+        values[i] = (int) i;
+        linked_list_insert(&source, &values[i]);
+    }
+
+    linked_list_insert(&list, &values[0]);
+    linked_list_extend(&list, &source);
+
+    TEST_ASSERT_EQUAL(11, list.size);
+    TEST_ASSERT_EQUAL(10, source.size);
+    TEST_ASSERT_EQUAL_PTR(&values[0], list.head->next->data);
+    TEST_ASSERT_EQUAL_PTR(&values[9], list.tail->data);
+    TEST_ASSERT_TRUE(linked_list_contains(&list, &values[5]));
+
+    linked_list_remove(&list, &values[5]);
+
+    TEST_ASSERT_EQUAL(10, list.size);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&source);
+}
+
+void test_GIVEN_linked_lists_WHEN_splice_THEN_source_is_appended_to_dest() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    linked_list_t source;
+    linked_list_init(&source);
+
+    int values[6] = { 0, 1, 2, 3, 4, 5 };
+
+    for (size_t i = 0; i < 3; i++) {
+        linked_list_insert(&list, &values[i]);
+        linked_list_insert(&source, &values[i + 3]);
+    }
+
+    linked_list_splice(&list, &source);
+
+    TEST_ASSERT_EQUAL(6, list.size);
+    TEST_ASSERT_EQUAL(0, source.size);
+    TEST_ASSERT_NULL(source.head);
+    TEST_ASSERT_NULL(source.tail);
+    TEST_ASSERT_EQUAL_PTR(&values[5], list.tail->data);
+    TEST_ASSERT_EQUAL_PTR(&values[2], list.tail->prev->prev->prev->data);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&source);
+}
+
+void test_GIVEN_linked_list_WHEN_splice_range_THEN_range_is_moved() {
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_index(&list);
+
+    linked_list_t dest;
+    linked_list_init(&dest);
+
+    int values[5] = { 0, 1, 2, 3, 4 };
+
+    for (size_t i = 0; i < 5; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    linked_list_splice_range(&dest, &list, list.head->next, list.tail->prev);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL_PTR(&values[0], list.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[4], list.head->next->data);
+    TEST_ASSERT_EQUAL_PTR(list.head, list.tail->prev);
+    TEST_ASSERT_FALSE(linked_list_contains(&list, &values[2]));
+
+    TEST_ASSERT_EQUAL(3, dest.size);
+    TEST_ASSERT_EQUAL_PTR(&values[1], dest.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[3], dest.tail->data);
+    TEST_ASSERT_NULL(dest.head->prev);
+    TEST_ASSERT_NULL(dest.tail->next);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+}
+
+void test_GIVEN_linked_list_WHEN_split_THEN_tail_is_moved() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    linked_list_t dest;
+    linked_list_init_pooled(&dest, 0);
+
+    int values[5] = { 0, 1, 2, 3, 4 };
+
+    for (size_t i = 0; i < 5; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    linked_list_split(&list, list.head->next->next, &dest);
+
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL_PTR(&values[1], list.tail->data);
+    TEST_ASSERT_NULL(list.tail->next);
+    TEST_ASSERT_EQUAL(3, dest.size);
+    TEST_ASSERT_EQUAL_PTR(&values[2], dest.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[4], dest.tail->data);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+}
+
+void test_GIVEN_linked_list_with_runs_WHEN_steal_if_count_THEN_runs_are_moved_in_order() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    linked_list_t dest;
+    linked_list_init(&dest);
+
+    int values[8] = { 1, 1, 2, 1, 1, 1, 2, 1 };
+
+    for (size_t i = 0; i < 8; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    int x = 2;
+    size_t moved = 0;
+
+    TEST_ASSERT_EQUAL(0, linked_list_steal_if_count(&list, &dest, &x, is_not_equal_to_x, &moved));
+
+    TEST_ASSERT_EQUAL(6, moved);
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL_PTR(&values[2], list.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[6], list.tail->data);
+    TEST_ASSERT_EQUAL_PTR(list.head, list.tail->prev);
+    TEST_ASSERT_EQUAL(6, dest.size);
+
+    size_t expected[6] = { 0, 1, 3, 4, 5, 7 };
+    size_t i = 0;
+
+    for (node_t* node = dest.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL_PTR(&values[expected[i++]], node->data);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(&values[7], dest.tail->data);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+}
+
+void test_GIVEN_large_linked_list_WHEN_sort_parallel_THEN_list_is_sorted_and_stable() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    size_t count = 100003;
+    int* values = malloc(count * sizeof(int));
+
+    for (size_t i = 0; i < count; i++) {
+        values[i] = (int) ((i * 7919) % 1000);
+        linked_list_insert(&list, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_parallel(&list, compare_int_descending, 8));
+
+    TEST_ASSERT_EQUAL(count, list.size);
+    TEST_ASSERT_NULL(list.head->prev);
+    TEST_ASSERT_NULL(list.tail->next);
+
+    size_t seen = 1;
+
+    for (node_t* node = list.head; node->next != NULL; node = node->next) {
+        int* a = node->data;
+        int* b = node->next->data;
+
+        TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+        TEST_ASSERT_TRUE(*a > *b || (*a == *b && a < b));
+
+        seen++;
+    }
+
+    TEST_ASSERT_EQUAL(count, seen);
+
+    linked_list_destroy(&list);
+    free(values);
+}
+
+void test_GIVEN_linked_lists_WHEN_sort_parallel_with_more_threads_than_root_of_size_THEN_lists_are_sorted() {
+    size_t sizes[4] = { 13, 8193, 32771, 57343 };
+    size_t threads[3] = { 64, 1000, SIZE_MAX };
+    int* values = malloc(sizes[3] * sizeof(int));
+
+    for (size_t s = 0; s < 4; s++) {
+        for (size_t t = 0; t < 3; t++) {
+            linked_list_t list;
+            linked_list_init(&list);
+
+            for (size_t i = 0; i < sizes[s]; i++) {
+                values[i] = (int) ((i * 7919) % 1000);
+                linked_list_insert(&list, &values[i]);
+            }
+
+            TEST_ASSERT_EQUAL(0, linked_list_sort_parallel(&list, compare_int_descending, threads[t]));
+            TEST_ASSERT_EQUAL(sizes[s], list.size);
+            assert_linked(&list);
+
+            for (node_t* node = list.head; node->next != NULL; node = node->next) {
+                int* a = node->data;
+                int* b = node->next->data;
+
+                TEST_ASSERT_TRUE(*a > *b || (*a == *b && a < b));
+            }
+
+            linked_list_destroy(&list);
+        }
+    }
+
+    free(values);
+}
+
+void test_GIVEN_linked_list_WHEN_sort_by_key_THEN_list_is_sorted_ascending_and_stable() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    int values[8] = { 70000, 3, 512, 3, 0, 65536, 70000, 1 };
+
+    for (size_t i = 0; i < 8; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_by_key(&list, int_key));
+
+    size_t expected[8] = { 4, 7, 1, 3, 2, 5, 0, 6 };
+    size_t i = 0;
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL_PTR(&values[expected[i++]], node->data);
+
+        if (node->next != NULL) {
+            TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(8, i);
+    TEST_ASSERT_EQUAL_PTR(&values[6], list.tail->data);
+    TEST_ASSERT_NULL(list.head->prev);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_large_linked_list_WHEN_sort_cached_THEN_list_is_sorted_and_linked() {
+    key_func_t prefixes[2] = { NULL, int_descending_prefix };
+
+    for (size_t p = 0; p < 2; p++) {
+        linked_list_t list;
+        linked_list_init(&list);
+
+        static int values[1000];
+
+        for (size_t i = 0; i < 1000; i++) {
+            values[i] = (int)((i * 7919) % 500);
+            linked_list_insert(&list, &values[i]);
+        }
+
+        TEST_ASSERT_EQUAL(0, linked_list_sort_cached(&list, compare_int_descending, prefixes[p]));
+        TEST_ASSERT_EQUAL(1000, list.size);
+        TEST_ASSERT_NULL(list.head->prev);
+        TEST_ASSERT_NULL(list.tail->next);
+
+        size_t count = 1;
+
+        for (node_t* node = list.head; node->next != NULL; node = node->next, count++) {
+            TEST_ASSERT_TRUE(*(int*)node->data >= *(int*)node->next->data);
+            TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+        }
+
+        TEST_ASSERT_EQUAL(1000, count);
+        TEST_ASSERT_EQUAL(499, *(int*)list.head->data);
+        TEST_ASSERT_EQUAL(0, *(int*)list.tail->data);
+
+        linked_list_destroy(&list);
+    }
+}
+
+void test_GIVEN_linked_list_WHEN_sort_r_variants_THEN_list_is_sorted_in_context_direction() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    static int values[20000];
+
+    for (size_t i = 0; i < 20000; i++) {
+        values[i] = (int)((i * 7919) % 1000);
+        linked_list_insert(&list, &values[i]);
+    }
+
+    int ascending = 1;
+    int descending = -1;
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_r(&list, compare_int_in_direction, &descending));
+    assert_sorted_in_direction(&list, descending);
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_parallel_r(&list, compare_int_in_direction, &ascending, 2));
+    assert_sorted_in_direction(&list, ascending);
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_by_key_r(&list, int_key_in_direction, &descending));
+    assert_sorted_in_direction(&list, descending);
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_cached_r(&list, compare_int_in_direction, &ascending, int_key_in_direction));
+    assert_sorted_in_direction(&list, ascending);
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_cached_r(&list, compare_int_in_direction, &descending, NULL));
+    assert_sorted_in_direction(&list, descending);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_sized_linked_list_WHEN_insert_THEN_elements_are_copied_into_nodes() {
+    linked_list_t list;
+    linked_list_init_sized_pooled(&list, sizeof(int), 0);
+
+    linked_list_t dest;
+    linked_list_init_sized(&dest, sizeof(int));
+
+    linked_list_t other;
+    linked_list_init_sized(&other, sizeof(long long));
+
+    for (int i = 0; i < 4; i++) {
+        int value = 30 - i * 10;
+        linked_list_insert(&list, &value);
+    }
+
+    int value = 10;
+
+    TEST_ASSERT_EQUAL(4, list.size);
+    TEST_ASSERT_EQUAL(0, *(int*)list.tail->data);
+    TEST_ASSERT_TRUE(linked_list_contains(&list, &value));
+    TEST_ASSERT_EQUAL(-1, linked_list_enable_index(&list));
+
+    TEST_ASSERT_EQUAL(0, linked_list_remove(&list, &value));
+    TEST_ASSERT_FALSE(linked_list_contains(&list, &value));
+
+    linked_list_sort(&list, compare_int_descending);
+    linked_list_sort_by_key(&list, int_key);
+
+    TEST_ASSERT_EQUAL(0, *(int*)list.head->data);
+    TEST_ASSERT_EQUAL(30, *(int*)list.tail->data);
+
+    TEST_ASSERT_EQUAL(0, linked_list_steal(&list, &dest, 0));
+    TEST_ASSERT_EQUAL(-1, linked_list_steal(&list, &other, 0));
+    TEST_ASSERT_EQUAL(2, list.size);
+    TEST_ASSERT_EQUAL(1, dest.size);
+    TEST_ASSERT_EQUAL(0, *(int*)dest.head->data);
+    TEST_ASSERT_EQUAL(0, other.size);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+    linked_list_destroy(&other);
+}
+
+void test_GIVEN_positioned_linked_list_WHEN_cursor_insert_and_erase_THEN_positions_follow() {
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_positions(&list);
+    linked_list_enable_index(&list);
+
+    int values[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    for (size_t i = 0; i < 6; i += 2) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    linked_list_cursor_t cursor;
+    linked_list_cursor_begin(&list, &cursor);
+
+    while (linked_list_cursor_get(&cursor) != NULL) {
+        int value = *(int*)linked_list_cursor_get(&cursor);
+
+        TEST_ASSERT_EQUAL(0, linked_list_cursor_insert_after(&cursor, &values[value + 1]));
+        TEST_ASSERT_EQUAL(0, linked_list_cursor_next(&cursor));
+        TEST_ASSERT_EQUAL(0, linked_list_cursor_next(&cursor));
+    }
+
+    TEST_ASSERT_EQUAL(-1, linked_list_cursor_next(&cursor));
+    TEST_ASSERT_EQUAL(-1, linked_list_cursor_insert_after(&cursor, &values[7]));
+    TEST_ASSERT_EQUAL(-1, linked_list_cursor_erase(&cursor));
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_insert_before(&cursor, &values[6]));
+    TEST_ASSERT_EQUAL(7, cursor.position);
+    TEST_ASSERT_EQUAL(7, list.size);
+
+    for (size_t i = 0; i < list.size; i++) {
+        TEST_ASSERT_EQUAL_PTR(&values[i], linked_list_at(&list, i));
+    }
+
+    linked_list_cursor_begin(&list, &cursor);
+
+    while (linked_list_cursor_get(&cursor) != NULL) {
+        if (*(int*)linked_list_cursor_get(&cursor) % 2 == 0) {
+            TEST_ASSERT_EQUAL(0, linked_list_cursor_erase(&cursor));
+        } else {
+            linked_list_cursor_next(&cursor);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(3, list.size);
+    TEST_ASSERT_FALSE(linked_list_contains(&list, &values[2]));
+
+    for (size_t i = 0; i < list.size; i++) {
+        TEST_ASSERT_EQUAL_PTR(&values[i * 2 + 1], linked_list_at(&list, i));
+    }
+
+    linked_list_cursor_end(&list, &cursor);
+
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_prev(&cursor));
+    TEST_ASSERT_EQUAL_PTR(&values[5], linked_list_cursor_get(&cursor));
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_insert_before(&cursor, &values[4]));
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_prev(&cursor));
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_prev(&cursor));
+    TEST_ASSERT_EQUAL(0, linked_list_cursor_prev(&cursor));
+    TEST_ASSERT_EQUAL(0, cursor.position);
+    TEST_ASSERT_EQUAL(-1, linked_list_cursor_prev(&cursor));
+    TEST_ASSERT_EQUAL_PTR(&values[4], linked_list_at(&list, 2));
+    TEST_ASSERT_EQUAL_PTR(list.tail->prev, list.head->next->next);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_pooled_linked_list_WHEN_push_and_pop_at_both_ends_THEN_list_behaves_as_deque() {
+    linked_list_t list;
+    linked_list_init_pooled(&list, 4);
+    linked_list_enable_index(&list);
+    linked_list_enable_positions(&list);
+
+    int values[6] = { 0, 1, 2, 3, 4, 5 };
+
+    TEST_ASSERT_NULL(linked_list_pop_front(&list));
+    TEST_ASSERT_NULL(linked_list_pop_back(&list));
+    TEST_ASSERT_NULL(linked_list_peek_front(&list));
+
+    for (size_t i = 3; i < 6; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    for (size_t i = 3; i > 0; i--) {
+        TEST_ASSERT_EQUAL(0, linked_list_push_front(&list, &values[i - 1]));
+    }
+
+    TEST_ASSERT_EQUAL(6, list.size);
+    TEST_ASSERT_EQUAL_PTR(&values[0], linked_list_peek_front(&list));
+    TEST_ASSERT_EQUAL_PTR(&values[5], linked_list_peek_back(&list));
+
+    for (size_t i = 0; i < list.size; i++) {
+        TEST_ASSERT_EQUAL_PTR(&values[i], linked_list_at(&list, i));
+    }
+
+    TEST_ASSERT_EQUAL_PTR(&values[0], linked_list_pop_front(&list));
+    TEST_ASSERT_EQUAL_PTR(&values[5], linked_list_pop_back(&list));
+    TEST_ASSERT_EQUAL_PTR(&values[1], linked_list_pop_front(&list));
+    TEST_ASSERT_FALSE(linked_list_contains(&list, &values[1]));
+    TEST_ASSERT_EQUAL(3, list.size);
+    TEST_ASSERT_EQUAL_PTR(&values[3], linked_list_at(&list, 1));
+
+    while (linked_list_pop_back(&list) != NULL) {
+    }
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_NULL(list.head);
+    TEST_ASSERT_NULL(list.tail);
+
+    linked_list_t sized;
+    linked_list_init_sized(&sized, sizeof(int));
+    linked_list_push_front(&sized, &values[2]);
+    linked_list_push_front(&sized, &values[1]);
+
+    TEST_ASSERT_EQUAL(1, *(int*)linked_list_peek_front(&sized));
+    TEST_ASSERT_NULL(linked_list_pop_front(&sized));
+    TEST_ASSERT_EQUAL(2, sized.size);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&sized);
+}
+
+void test_GIVEN_linked_lists_WHEN_insert_sorted_THEN_lists_stay_sorted_and_stable() {
+    linked_list_t lists[2];
+    linked_list_init(&lists[0]);
+    linked_list_init_pooled(&lists[1], 16);
+    linked_list_enable_positions(&lists[1]);
+
+    int values[200];
+
+    for (size_t i = 0; i < 200; i++) {
+        values[i] = (int) (i * 37 % 101);
+    }
+
+    for (size_t l = 0; l < 2; l++) {
+        linked_list_t* list = &lists[l];
+
+        linked_list_insert(list, &values[0]);
+        linked_list_insert(list, &values[1]);
+
+        for (size_t i = 2; i < 200; i++) {
+            TEST_ASSERT_EQUAL(0, linked_list_insert_sorted(list, &values[i], compare_int_descending));
+        }
+
+        TEST_ASSERT_EQUAL(200, list->size);
+        TEST_ASSERT_EQUAL_PTR(compare_int_descending, list->sorted_by);
+        TEST_ASSERT_NOT_NULL(list->positions);
+
+        size_t position = 0;
+
+        for (node_t* node = list->head; node != NULL; node = node->next, position++) {
+            TEST_ASSERT_EQUAL_PTR(node->data, linked_list_at(list, position));
+        }
+
+        for (node_t* node = list->head; node->next != NULL; node = node->next) {
+            TEST_ASSERT_TRUE(compare_int_descending(node->data, node->next->data) <= 0);
+            TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+
+            if (compare_int_descending(node->data, node->next->data) == 0) {
+                TEST_ASSERT_TRUE((int*)node->data < (int*)node->next->data);
+            }
+        }
+
+        node_t* head = list->head;
+
+        TEST_ASSERT_EQUAL(0, linked_list_sort(list, compare_int_descending));
+        TEST_ASSERT_EQUAL_PTR(head, list->head);
+
+        linked_list_insert(list, &values[0]);
+
+        TEST_ASSERT_NULL(list->sorted_by);
+    }
+
+    TEST_ASSERT_EQUAL(100, *(int*)linked_list_at(&lists[1], 0));
+
+    for (node_t *a = lists[0].head, *b = lists[1].head; a != NULL; a = a->next, b = b->next) {
+        TEST_ASSERT_EQUAL_PTR(a->data, b->data);
+    }
+
+    linked_list_destroy(&lists[0]);
+    linked_list_destroy(&lists[1]);
+}
+
+void test_GIVEN_arena_linked_list_WHEN_clear_and_reuse_THEN_nodes_come_from_reset_arena() {
+    linked_list_t list;
+    linked_list_init_arena(&list, 4);
+    linked_list_enable_index(&list);
+
+    linked_list_t sized;
+    linked_list_init_sized_arena(&sized, sizeof(int), 0);
+
+    int values[5000];
+
+    for (size_t round = 0; round < 3; round++) {
+        for (size_t i = 0; i < 5000; i++) {
+            values[i] = (int) (i + round);
+            linked_list_insert(&list, &values[i]);
+            linked_list_insert(&sized, &values[i]);
+        }
+
+        TEST_ASSERT_EQUAL(0, linked_list_remove(&list, &values[10]));
+        TEST_ASSERT_EQUAL(4999, list.size);
+        TEST_ASSERT_EQUAL(5000, sized.size);
+        TEST_ASSERT_EQUAL_PTR(&values[4999], list.tail->data);
+        TEST_ASSERT_EQUAL((int) (4999 + round), *(int*)sized.tail->data);
+
+        TEST_ASSERT_EQUAL(0, linked_list_clear(&list));
+        TEST_ASSERT_EQUAL(0, linked_list_clear(&sized));
+        TEST_ASSERT_EQUAL(0, list.size);
+        TEST_ASSERT_NULL(list.head);
+        TEST_ASSERT_FALSE(linked_list_contains(&list, &values[0]));
+    }
+
+    linked_list_insert(&list, &values[0]);
+    linked_list_insert(&sized, &values[0]);
+
+    TEST_ASSERT_EQUAL_PTR(&values[0], linked_list_pop_front(&list));
+
+    linked_list_t batched;
+    linked_list_init_arena(&batched, 4);
+
+    void* items[5000];
+
+    for (size_t i = 0; i < 5000; i++) {
+        items[i] = &values[i];
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_insert_many(&batched, items, 5000));
+    TEST_ASSERT_EQUAL(0, linked_list_insert(&batched, &values[0]));
+
+    linked_list_pool_stats_t stats;
+
+    TEST_ASSERT_EQUAL(0, linked_list_pool_stats(&batched, &stats));
+    TEST_ASSERT_EQUAL(2, stats.chunks);
+
+    TEST_ASSERT_EQUAL(0, linked_list_clear(&batched));
+    TEST_ASSERT_EQUAL(0, linked_list_pool_stats(&batched, &stats));
+    TEST_ASSERT_EQUAL(1, stats.chunks);
+    TEST_ASSERT_EQUAL(5000, stats.capacity);
+
+    TEST_ASSERT_EQUAL(0, linked_list_insert_many(&batched, items, 5000));
+    TEST_ASSERT_EQUAL(0, linked_list_pool_stats(&batched, &stats));
+    TEST_ASSERT_EQUAL(1, stats.chunks);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&sized);
+    linked_list_destroy(&batched);
+}
+
+void test_GIVEN_linked_list_WHEN_budgeted_steps_THEN_operations_complete_over_several_calls() {
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_positions(&list);
+
+    linked_list_t dest;
+    linked_list_init_pooled(&dest, 0);
+
+    int values[1000];
+    int x = 7;
+
+    for (size_t i = 0; i < 1000; i++) {
+        values[i] = (int) (i * 37 % 101);
+        linked_list_insert(&list, &values[i]);
+    }
+
+    linked_list_step_t step;
+    linked_list_step_init(&step);
+
+    size_t steps = 0;
+
+    while (!step.done) {
+        TEST_ASSERT_EQUAL(0, linked_list_sort_step(&list, &step, compare_int_descending, 64));
+        assert_linked(&list);
+        steps++;
+    }
+
+    TEST_ASSERT_TRUE(steps > 100);
+    TEST_ASSERT_EQUAL_PTR(compare_int_descending, list.sorted_by);
+    assert_sorted_in_direction(&list, -1);
+
+    for (node_t* node = list.head; node->next != NULL; node = node->next) {
+        if (compare_int_descending(node->data, node->next->data) == 0) {
+            TEST_ASSERT_TRUE((int*)node->data < (int*)node->next->data);
+        }
+    }
+
+    int ascending = 1;
+
+    linked_list_step_init(&step);
+
+    while (!step.done) {
+        TEST_ASSERT_EQUAL(0, linked_list_sort_step_r(&list, &step, compare_int_in_direction, &ascending, 64));
+        assert_linked(&list);
+    }
+
+    TEST_ASSERT_NULL(list.sorted_by);
+    assert_sorted_in_direction(&list, 1);
+
+    for (node_t* node = list.head; node->next != NULL; node = node->next) {
+        if (compare_int_in_direction(node->data, node->next->data, &ascending) == 0) {
+            TEST_ASSERT_TRUE((int*)node->data < (int*)node->next->data);
+        }
+    }
+
+    linked_list_step_init(&step);
+
+    while (!step.done) {
+        TEST_ASSERT_EQUAL(0, linked_list_remove_if_step(&list, &step, &x, is_not_equal_to_x, 100));
+        assert_linked(&list);
+    }
+
+    TEST_ASSERT_EQUAL(9, list.size);
+    TEST_ASSERT_EQUAL(7, *(int*)linked_list_at(&list, 8));
+
+    linked_list_step_init(&step);
+    linked_list_steal_if_step(&list, &dest, &step, &values[0], is_not_equal_to_x, 4);
+    linked_list_insert(&list, &values[1]);
+
+    while (!step.done) {
+        TEST_ASSERT_EQUAL(0, linked_list_steal_if_step(&list, &dest, &step, &values[0], is_not_equal_to_x, 4));
+    }
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_EQUAL(10, dest.size);
+    TEST_ASSERT_EQUAL_PTR(&values[1], dest.tail->data);
+
+    linked_list_enable_index(&dest);
+    linked_list_step_init(&step);
+    steps = 0;
+
+    while (!step.done) {
+        TEST_ASSERT_EQUAL(0, linked_list_clear_step(&dest, &step, 3));
+        assert_linked(&dest);
+        steps++;
+    }
+
+    TEST_ASSERT_EQUAL(4, steps);
+    TEST_ASSERT_EQUAL(0, dest.size);
+    TEST_ASSERT_NULL(dest.tail);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&dest);
+}
+
+void test_GIVEN_pooled_linked_list_WHEN_insert_many_and_clear_repeatedly_THEN_chunk_count_is_stable() {
+    linked_list_t list;
+    linked_list_init_pooled(&list, 64);
+
+    int values[1000];
+    void* items[1000];
+
+    for (size_t i = 0; i < 1000; i++) {
+        values[i] = (int) i;
+        items[i] = &values[i];
+    }
+
+    linked_list_pool_stats_t first;
+    linked_list_pool_stats_t stats;
+
+    linked_list_insert_many(&list, items, 1000);
+    linked_list_clear(&list);
+    TEST_ASSERT_EQUAL(0, linked_list_pool_stats(&list, &first));
+
+    for (size_t round = 0; round < 200; round++) {
+        TEST_ASSERT_EQUAL(0, linked_list_insert_many(&list, items, 1000 - round));
+        TEST_ASSERT_EQUAL(0, linked_list_remove(&list, &values[0]));
+        TEST_ASSERT_EQUAL(999 - round, list.size);
+        TEST_ASSERT_EQUAL_PTR(&values[999 - round], list.tail->data);
+        linked_list_clear(&list);
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_pool_stats(&list, &stats));
+    TEST_ASSERT_EQUAL(first.chunks, stats.chunks);
+    TEST_ASSERT_EQUAL(first.memory, stats.memory);
+
+    linked_list_t unpooled;
+    linked_list_init(&unpooled);
+    TEST_ASSERT_EQUAL(-1, linked_list_pool_stats(&unpooled, &stats));
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_linked_list_WHEN_insert_sorted_r_THEN_list_stays_sorted_in_context_direction() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    int values[100];
+    int ascending = 1;
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) (i * 37 % 31);
+    }
+
+    linked_list_insert(&list, &values[0]);
+    linked_list_insert(&list, &values[1]);
+
+    for (size_t i = 2; i < 100; i++) {
+        TEST_ASSERT_EQUAL(0, linked_list_insert_sorted_r(&list, &values[i], compare_int_in_direction, &ascending));
+    }
+
+    TEST_ASSERT_EQUAL(100, list.size);
+    TEST_ASSERT_EQUAL_PTR(compare_int_in_direction, list.sorted_by_r);
+    TEST_ASSERT_EQUAL_PTR(&ascending, list.sorted_ctx);
+    TEST_ASSERT_NULL(list.sorted_by);
+    assert_sorted_in_direction(&list, 1);
+
+    for (node_t* node = list.head; node->next != NULL; node = node->next) {
+        if (compare_int_in_direction(node->data, node->next->data, &ascending) == 0) {
+            TEST_ASSERT_TRUE((int*)node->data < (int*)node->next->data);
+        }
+    }
+
+    int descending = -1;
+
+    TEST_ASSERT_EQUAL(0, linked_list_insert_sorted_r(&list, &values[0], compare_int_in_direction, &descending));
+    assert_sorted_in_direction(&list, -1);
+
+    linked_list_push_front(&list, &values[1]);
+
+    TEST_ASSERT_NULL(list.sorted_by_r);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_sorted_linked_list_WHEN_data_changed_and_sorted_again_THEN_list_is_resorted() {
+    linked_list_t list;
+    linked_list_init(&list);
+
+    int values[] = { 3, 1, 2 };
+    int x = 0;
+
+    for (size_t i = 0; i < 3; i++) {
+        linked_list_insert(&list, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort(&list, compare_int_descending));
+    assert_sorted_in_direction(&list, -1);
+
+    values[1] = 10;
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort(&list, compare_int_descending));
+    TEST_ASSERT_EQUAL(10, *(int*)linked_list_at(&list, 0));
+    TEST_ASSERT_EQUAL(3, *(int*)linked_list_at(&list, 1));
+    TEST_ASSERT_EQUAL(2, *(int*)linked_list_at(&list, 2));
+
+    values[1] = -10;
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_parallel(&list, compare_int_descending, 2));
+    TEST_ASSERT_EQUAL(-10, *(int*)list.tail->data);
+
+    values[1] = 20;
+
+    TEST_ASSERT_EQUAL(0, linked_list_sort_cached(&list, compare_int_descending, NULL));
+    TEST_ASSERT_EQUAL(20, *(int*)list.head->data);
+
+    values[1] = 1;
+
+    TEST_ASSERT_EQUAL(0, linked_list_mark_unsorted(&list));
+    TEST_ASSERT_NULL(list.sorted_by);
+    TEST_ASSERT_EQUAL(0, linked_list_insert_sorted(&list, &x, compare_int_descending));
+    TEST_ASSERT_EQUAL(4, list.size);
+    TEST_ASSERT_EQUAL_PTR(compare_int_descending, list.sorted_by);
+    assert_sorted_in_direction(&list, -1);
+    assert_linked(&list);
+
+    linked_list_destroy(&list);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_linked_list_WHEN_new_THEN_memory_is_allocated_and_linked_list_is_initialised);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_init_THEN_linked_list_in_initialised_state);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_insert_THEN_node_is_inserted);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_insert_multiple_then_nodes_are_inserted);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_remove_THEN_node_is_removed);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_remove_multiple_THEN_nodes_are_removed);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_clear_THEN_list_is_empty);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_steal_THEN_node_is_moved);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_remove_if_THEN_remove_if_value_is_not_equal_to_x);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_steal_if_THEN_steal_if_value_is_not_equal_to_x);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_sort_THEN_list_is_sorted);
+    RUN_TEST(test_GIVEN_pooled_linked_list_WHEN_insert_and_remove_THEN_nodes_are_recycled);
+    RUN_TEST(test_GIVEN_pooled_linked_list_WHEN_steal_to_unpooled_list_THEN_node_is_moved);
+    RUN_TEST(test_GIVEN_large_reverse_sorted_linked_list_WHEN_sort_THEN_list_is_sorted_and_linked);
+    RUN_TEST(test_GIVEN_linked_list_with_equal_values_WHEN_sort_THEN_order_of_equal_values_is_kept);
+    RUN_TEST(test_GIVEN_indexed_linked_list_WHEN_remove_THEN_node_is_removed);
+    RUN_TEST(test_GIVEN_indexed_linked_list_WHEN_steal_THEN_both_indexes_are_updated);
+    RUN_TEST(test_GIVEN_positioned_linked_list_WHEN_insert_at_THEN_data_is_at_position);
+    RUN_TEST(test_GIVEN_positioned_linked_list_WHEN_steal_in_loop_THEN_nodes_are_moved);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_insert_many_THEN_nodes_are_inserted_in_order);
+    RUN_TEST(test_GIVEN_pooled_linked_list_WHEN_extend_THEN_data_is_copied_from_source);
+    RUN_TEST(test_GIVEN_pooled_linked_list_WHEN_insert_many_and_clear_repeatedly_THEN_chunk_count_is_stable);
+    RUN_TEST(test_GIVEN_linked_lists_WHEN_splice_THEN_source_is_appended_to_dest);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_splice_range_THEN_range_is_moved);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_split_THEN_tail_is_moved);
+    RUN_TEST(test_GIVEN_linked_list_with_runs_WHEN_steal_if_count_THEN_runs_are_moved_in_order);
+    RUN_TEST(test_GIVEN_large_linked_list_WHEN_sort_parallel_THEN_list_is_sorted_and_stable);
+    RUN_TEST(test_GIVEN_linked_lists_WHEN_sort_parallel_with_more_threads_than_root_of_size_THEN_lists_are_sorted);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_sort_by_key_THEN_list_is_sorted_ascending_and_stable);
+    RUN_TEST(test_GIVEN_large_linked_list_WHEN_sort_cached_THEN_list_is_sorted_and_linked);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_sort_r_variants_THEN_list_is_sorted_in_context_direction);
+    RUN_TEST(test_GIVEN_sized_linked_list_WHEN_insert_THEN_elements_are_copied_into_nodes);
+    RUN_TEST(test_GIVEN_positioned_linked_list_WHEN_cursor_insert_and_erase_THEN_positions_follow);
+    RUN_TEST(test_GIVEN_pooled_linked_list_WHEN_push_and_pop_at_both_ends_THEN_list_behaves_as_deque);
+    RUN_TEST(test_GIVEN_linked_lists_WHEN_insert_sorted_THEN_lists_stay_sorted_and_stable);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_insert_sorted_r_THEN_list_stays_sorted_in_context_direction);
+    RUN_TEST(test_GIVEN_sorted_linked_list_WHEN_data_changed_and_sorted_again_THEN_list_is_resorted);
+    RUN_TEST(test_GIVEN_arena_linked_list_WHEN_clear_and_reuse_THEN_nodes_come_from_reset_arena);
+    RUN_TEST(test_GIVEN_linked_list_WHEN_budgeted_steps_THEN_operations_complete_over_several_calls);
+
+    return UNITY_END();
+}
+
+bool is_not_equal_to_x(void* value, void* x) {
+    return *(int*)value != *(int*)x;
+}
+
+uint64_t int_key(const void *value) {
+    return (uint64_t) *(int*)value;
+}
+
+uint64_t int_descending_prefix(const void *value) {
+    return (uint64_t) (1000 - *(int*)value) / 16;
+}
+
+int compare_int_descending(const void *a, const void *b) {
+    int x = *(int*)a;
+    int y = *(int*)b;
+
+    if (x < y) {
+        return 1;
+    } 
+    
+    if (x > y) {
+        return -1;
+    }
+
+    return 0;
+}
+
+int compare_int_in_direction(const void *a, const void *b, void *direction) {
+    int x = *(int*)a;
+    int y = *(int*)b;
+
+    if (x < y) {
+        return -*(int*)direction;
+    }
+
+    if (x > y) {
+        return *(int*)direction;
+    }
+
+    return 0;
+}
+
+uint64_t int_key_in_direction(const void *value, void *direction) {
+    return (uint64_t) (1000 + *(int*)direction * *(int*)value);
+}
+
+void assert_sorted_in_direction(linked_list_t* list, int direction) {
+    size_t count = 1;
+
+    TEST_ASSERT_NULL(list->head->prev);
+
+    for (node_t* node = list->head; node->next != NULL; node = node->next, count++) {
+        TEST_ASSERT_TRUE(compare_int_in_direction(node->data, node->next->data, &direction) <= 0);
+        TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+    }
+
+    TEST_ASSERT_EQUAL(list->size, count);
+}
+
+void assert_linked(linked_list_t* list) {
+    size_t count = 0;
+    node_t* prev = NULL;
+
+    for (node_t* node = list->head; node != NULL; prev = node, node = node->next, count++) {
+        TEST_ASSERT_EQUAL_PTR(prev, node->prev);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(prev, list->tail);
+    TEST_ASSERT_EQUAL(list->size, count);
 }
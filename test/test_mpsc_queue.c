@@ -0,0 +1,199 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <unity.h>
+
+#include <scds/mpsc_queue.h>
+
+#define PRODUCERS 4
+#define ITEMS_PER_PRODUCER 20000
+
+typedef struct producer {
+    mpsc_queue_t *queue;
+    int *values;
+} producer_t;
+
+static void* produce(void* arg);
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_mpsc_queue_WHEN_push_and_pop_THEN_nodes_are_popped_in_order() {
+    mpsc_queue_t queue;
+    mpsc_queue_init(&queue);
+
+    node_t nodes[3];
+    int values[3] = { 1, 2, 3 };
+
+    TEST_ASSERT_NULL(mpsc_queue_pop(&queue));
+
+    for (size_t i = 0; i < 3; i++) {
+        nodes[i].data = &values[i];
+        mpsc_queue_push(&queue, &nodes[i]);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(&nodes[0], mpsc_queue_pop(&queue));
+    TEST_ASSERT_EQUAL_PTR(&nodes[1], mpsc_queue_pop(&queue));
+
+    mpsc_queue_push(&queue, &nodes[0]);
+
+    TEST_ASSERT_EQUAL_PTR(&nodes[2], mpsc_queue_pop(&queue));
+    TEST_ASSERT_EQUAL_PTR(&nodes[0], mpsc_queue_pop(&queue));
+    TEST_ASSERT_NULL(mpsc_queue_pop(&queue));
+}
+
+void test_GIVEN_mpsc_queue_WHEN_drain_into_pooled_list_THEN_data_is_copied_in_order() {
+    mpsc_queue_t queue;
+    mpsc_queue_init(&queue);
+
+    linked_list_t list;
+    linked_list_init_pooled(&list, 0);
+
+    int values[5] = { 1, 2, 3, 4, 5 };
+    size_t drained = 0;
+
+    for (size_t i = 0; i < 5; i++) {
+        mpsc_queue_push_data(&queue, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL(0, mpsc_queue_drain(&queue, &list, 3, &drained));
+    TEST_ASSERT_EQUAL(3, drained);
+    TEST_ASSERT_EQUAL(0, mpsc_queue_drain(&queue, &list, 0, &drained));
+    TEST_ASSERT_EQUAL(2, drained);
+    TEST_ASSERT_EQUAL(0, mpsc_queue_drain(&queue, &list, 0, &drained));
+    TEST_ASSERT_EQUAL(0, drained);
+
+    size_t i = 0;
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL_PTR(&values[i++], node->data);
+    }
+
+    TEST_ASSERT_EQUAL(5, i);
+    TEST_ASSERT_EQUAL(5, list.size);
+
+    linked_list_destroy(&list);
+}
+
+void test_GIVEN_mpsc_queue_with_nodes_left_WHEN_destroy_THEN_nodes_are_freed_and_queue_is_empty() {
+    mpsc_queue_t queue;
+    mpsc_queue_init(&queue);
+
+    int values[5] = { 1, 2, 3, 4, 5 };
+
+    TEST_ASSERT_EQUAL(0, mpsc_queue_destroy(&queue));
+
+    for (size_t i = 0; i < 5; i++) {
+        mpsc_queue_push_data(&queue, &values[i]);
+    }
+
+    node_t* node = mpsc_queue_pop(&queue);
+
+    TEST_ASSERT_EQUAL_PTR(&values[0], node->data);
+    free(node);
+
+    TEST_ASSERT_EQUAL(0, mpsc_queue_destroy(&queue));
+    TEST_ASSERT_NULL(mpsc_queue_pop(&queue));
+
+    mpsc_queue_push_data(&queue, &values[0]);
+
+    node = mpsc_queue_pop(&queue);
+
+    TEST_ASSERT_EQUAL_PTR(&values[0], node->data);
+    free(node);
+
+    TEST_ASSERT_EQUAL(0, mpsc_queue_destroy(&queue));
+}
+
+void test_GIVEN_concurrent_producers_WHEN_drain_THEN_every_item_arrives_in_producer_order() {
+    mpsc_queue_t queue;
+    mpsc_queue_init(&queue);
+
+    linked_list_t list;
+    linked_list_init(&list);
+
+    pthread_t threads[PRODUCERS];
+    producer_t producers[PRODUCERS];
+    int* values = malloc(PRODUCERS * ITEMS_PER_PRODUCER * sizeof(int));
+
+    for (size_t p = 0; p < PRODUCERS; p++) {
+        producers[p].queue = &queue;
+        producers[p].values = &values[p * ITEMS_PER_PRODUCER];
+
+        for (size_t i = 0; i < ITEMS_PER_PRODUCER; i++) {
+            producers[p].values[i] = (int) i;
+        }
+
+        pthread_create(&threads[p], NULL, produce, &producers[p]);
+    }
+
+    while (list.size < PRODUCERS * ITEMS_PER_PRODUCER) {
+        TEST_ASSERT_EQUAL(0, mpsc_queue_drain(&queue, &list, 1000, NULL));
+    }
+
+    for (size_t p = 0; p < PRODUCERS; p++) {
+        pthread_join(threads[p], NULL);
+    }
+
+    TEST_ASSERT_NULL(mpsc_queue_pop(&queue));
+
+    int next[PRODUCERS] = { 0 };
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        size_t p = (size_t) ((int*) node->data - values) / ITEMS_PER_PRODUCER;
+
+        TEST_ASSERT_EQUAL(next[p]++, *(int*) node->data);
+    }
+
+    for (size_t p = 0; p < PRODUCERS; p++) {
+        TEST_ASSERT_EQUAL(ITEMS_PER_PRODUCER, next[p]);
+    }
+
+    linked_list_destroy(&list);
+    free(values);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_mpsc_queue_WHEN_push_and_pop_THEN_nodes_are_popped_in_order);
+    RUN_TEST(test_GIVEN_mpsc_queue_WHEN_drain_into_pooled_list_THEN_data_is_copied_in_order);
+    RUN_TEST(test_GIVEN_mpsc_queue_with_nodes_left_WHEN_destroy_THEN_nodes_are_freed_and_queue_is_empty);
+    RUN_TEST(test_GIVEN_concurrent_producers_WHEN_drain_THEN_every_item_arrives_in_producer_order);
+
+    return UNITY_END();
+}
+
+void* produce(void* arg) {
+    producer_t* producer = arg;
+
+    for (size_t i = 0; i < ITEMS_PER_PRODUCER; i++) {
+        mpsc_queue_push_data(producer->queue, &producer->values[i]);
+    }
+
+    return NULL;
+}
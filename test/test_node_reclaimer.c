@@ -0,0 +1,123 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdlib.h>
+
+#include <unity.h>
+
+#include <scds/linked_list.h>
+#include <scds/node_reclaimer.h>
+
+#define ITEMS 10000
+
+static bool is_odd(void* value, void* unused);
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_linked_list_with_reclaimer_WHEN_clear_THEN_nodes_are_freed_in_background() {
+    node_reclaimer_t reclaimer;
+    TEST_ASSERT_EQUAL(0, node_reclaimer_init(&reclaimer));
+
+    linked_list_t list;
+    linked_list_init_sized(&list, sizeof(int));
+
+    TEST_ASSERT_EQUAL(0, linked_list_set_reclaimer(&list, &reclaimer));
+
+    for (int i = 0; i < ITEMS; i++) {
+        linked_list_insert(&list, &i);
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_clear(&list));
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_NULL(list.head);
+
+    int value = 1;
+    linked_list_insert(&list, &value);
+
+    TEST_ASSERT_EQUAL(0, node_reclaimer_wait(&reclaimer));
+    TEST_ASSERT_EQUAL(ITEMS, reclaimer.freed);
+
+    linked_list_destroy(&list);
+
+    TEST_ASSERT_EQUAL(0, node_reclaimer_wait(&reclaimer));
+    TEST_ASSERT_EQUAL(ITEMS + 1, reclaimer.freed);
+    TEST_ASSERT_EQUAL(0, node_reclaimer_destroy(&reclaimer));
+}
+
+void test_GIVEN_linked_lists_with_reclaimer_WHEN_remove_if_THEN_removed_nodes_are_freed_in_background() {
+    node_reclaimer_t reclaimer;
+    TEST_ASSERT_EQUAL(0, node_reclaimer_init(&reclaimer));
+
+    linked_list_t list;
+    linked_list_init(&list);
+    linked_list_enable_positions(&list);
+    linked_list_set_reclaimer(&list, &reclaimer);
+
+    linked_list_t pooled;
+    linked_list_init_pooled(&pooled, 0);
+
+    TEST_ASSERT_EQUAL(-1, linked_list_set_reclaimer(&pooled, &reclaimer));
+
+    int* values = malloc(ITEMS * sizeof(int));
+
+    for (int i = 0; i < ITEMS; i++) {
+        values[i] = i;
+        linked_list_insert(&list, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL(0, linked_list_remove_if(&list, NULL, is_odd));
+    TEST_ASSERT_EQUAL(ITEMS / 2, list.size);
+    TEST_ASSERT_EQUAL_PTR(&values[2], linked_list_at(&list, 1));
+
+    linked_list_step_t step;
+    linked_list_step_init(&step);
+
+    while (!step.done) {
+        TEST_ASSERT_EQUAL(0, linked_list_clear_step(&list, &step, 1000));
+    }
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_EQUAL(0, node_reclaimer_wait(&reclaimer));
+    TEST_ASSERT_EQUAL(ITEMS, reclaimer.freed);
+    TEST_ASSERT_TRUE(reclaimer.submitted >= 6);
+
+    linked_list_destroy(&list);
+    linked_list_destroy(&pooled);
+    TEST_ASSERT_EQUAL(0, node_reclaimer_destroy(&reclaimer));
+    free(values);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_linked_list_with_reclaimer_WHEN_clear_THEN_nodes_are_freed_in_background);
+    RUN_TEST(test_GIVEN_linked_lists_with_reclaimer_WHEN_remove_if_THEN_removed_nodes_are_freed_in_background);
+
+    return UNITY_END();
+}
+
+bool is_odd(void* value, void* unused) {
+    return *(int*)value % 2 != 0;
+}
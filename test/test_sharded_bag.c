@@ -0,0 +1,128 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <unity.h>
+
+#include <scds/sharded_bag.h>
+
+#define THREADS 4
+#define ITEMS_PER_THREAD 10000
+
+typedef struct inserter {
+    sharded_bag_t *bag;
+    int *values;
+} inserter_t;
+
+static void* insert_values(void* arg);
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_sharded_bag_WHEN_insert_and_collect_THEN_items_are_spliced_into_list() {
+    sharded_bag_t bag;
+    TEST_ASSERT_EQUAL(0, sharded_bag_init(&bag, 4));
+
+    int values[3] = { 1, 2, 3 };
+
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(0, sharded_bag_insert(&bag, &values[i]));
+    }
+
+    TEST_ASSERT_EQUAL(3, sharded_bag_size(&bag));
+
+    linked_list_t list;
+    linked_list_init(&list);
+
+    TEST_ASSERT_EQUAL(0, sharded_bag_collect(&bag, &list));
+    TEST_ASSERT_EQUAL(3, list.size);
+    TEST_ASSERT_EQUAL(0, sharded_bag_size(&bag));
+    TEST_ASSERT_EQUAL_PTR(&values[0], list.head->data);
+    TEST_ASSERT_EQUAL_PTR(&values[2], list.tail->data);
+
+    linked_list_destroy(&list);
+    sharded_bag_destroy(&bag);
+}
+
+void test_GIVEN_concurrent_inserters_WHEN_collect_THEN_every_item_is_collected() {
+    sharded_bag_t bag;
+    TEST_ASSERT_EQUAL(0, sharded_bag_init(&bag, 0));
+
+    pthread_t threads[THREADS];
+    inserter_t inserters[THREADS];
+    int* values = calloc(THREADS * ITEMS_PER_THREAD, sizeof(int));
+
+    linked_list_t list;
+    linked_list_init(&list);
+
+    for (size_t t = 0; t < THREADS; t++) {
+        inserters[t].bag = &bag;
+        inserters[t].values = &values[t * ITEMS_PER_THREAD];
+
+        pthread_create(&threads[t], NULL, insert_values, &inserters[t]);
+    }
+
+    TEST_ASSERT_EQUAL(0, sharded_bag_collect(&bag, &list));
+
+    for (size_t t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    TEST_ASSERT_EQUAL(THREADS * ITEMS_PER_THREAD, list.size + sharded_bag_size(&bag));
+    TEST_ASSERT_EQUAL(0, sharded_bag_collect(&bag, &list));
+    TEST_ASSERT_EQUAL(THREADS * ITEMS_PER_THREAD, list.size);
+
+    for (node_t* node = list.head; node != NULL; node = node->next) {
+        (*(int*)node->data)++;
+    }
+
+    for (size_t i = 0; i < THREADS * ITEMS_PER_THREAD; i++) {
+        TEST_ASSERT_EQUAL(1, values[i]);
+    }
+
+    linked_list_destroy(&list);
+    sharded_bag_destroy(&bag);
+    free(values);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_sharded_bag_WHEN_insert_and_collect_THEN_items_are_spliced_into_list);
+    RUN_TEST(test_GIVEN_concurrent_inserters_WHEN_collect_THEN_every_item_is_collected);
+
+    return UNITY_END();
+}
+
+void* insert_values(void* arg) {
+    inserter_t* inserter = arg;
+
+    for (size_t i = 0; i < ITEMS_PER_THREAD; i++) {
+        sharded_bag_insert(inserter->bag, &inserter->values[i]);
+    }
+
+    return NULL;
+}
@@ -0,0 +1,166 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <unity.h>
+
+#include <scds/typed_list.h>
+
+typedef struct point {
+    int x;
+    int y;
+} point_t;
+
+static int compare_int(const int *a, const int *b);
+static int compare_point_x(const point_t *a, const point_t *b);
+static bool is_odd(int* value, void* x);
+
+SCDS_LIST_DEFINE(int_list, int, compare_int)
+SCDS_LIST_DEFINE(point_list, point_t, compare_point_x)
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_typed_list_WHEN_insert_and_remove_THEN_values_are_stored_inline() {
+    int_list_t list;
+    int_list_init(&list);
+
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL(0, int_list_insert(&list, i * 10));
+    }
+
+    TEST_ASSERT_EQUAL(0, int_list_insert_at(&list, 2, 15));
+    TEST_ASSERT_EQUAL(6, list.size);
+    TEST_ASSERT_EQUAL(15, *int_list_at(&list, 2));
+    TEST_ASSERT_EQUAL(40, *int_list_at(&list, 5));
+    TEST_ASSERT_NULL(int_list_at(&list, 6));
+
+    TEST_ASSERT_TRUE(int_list_contains(&list, 30));
+    TEST_ASSERT_EQUAL(0, int_list_remove(&list, 30));
+    TEST_ASSERT_FALSE(int_list_contains(&list, 30));
+    TEST_ASSERT_EQUAL(-1, int_list_remove(&list, 30));
+
+    int expected[5] = { 0, 10, 15, 20, 40 };
+    size_t i = 0;
+
+    for (int_list_node_t* node = list.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL(expected[i++], node->value);
+
+        if (node->next != NULL) {
+            TEST_ASSERT_EQUAL_PTR(node, node->next->prev);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(5, i);
+    TEST_ASSERT_EQUAL(40, list.tail->value);
+
+    int_list_destroy(&list);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_NULL(list.head);
+}
+
+void test_GIVEN_typed_list_WHEN_sort_THEN_values_are_sorted_and_stable() {
+    point_list_t list;
+    point_list_init(&list);
+
+    point_t points[6] = { { 3, 0 }, { 1, 1 }, { 3, 2 }, { 2, 3 }, { 1, 4 }, { 0, 5 } };
+
+    TEST_ASSERT_EQUAL(0, point_list_insert_many(&list, points, 6));
+    TEST_ASSERT_EQUAL(0, point_list_sort(&list));
+
+    int expected[6] = { 5, 1, 4, 3, 0, 2 };
+    size_t i = 0;
+
+    for (point_list_node_t* node = list.head; node != NULL; node = node->next) {
+        TEST_ASSERT_EQUAL(expected[i++], node->value.y);
+    }
+
+    TEST_ASSERT_EQUAL(6, i);
+    TEST_ASSERT_NULL(list.head->prev);
+    TEST_ASSERT_EQUAL(2, list.tail->value.y);
+
+    point_list_clear(&list);
+}
+
+void test_GIVEN_typed_lists_WHEN_steal_if_splice_and_split_THEN_nodes_are_moved() {
+    int_list_t list;
+    int_list_t odd;
+    int_list_t copy;
+    int_list_init(&list);
+    int_list_init(&odd);
+    int_list_init(&copy);
+
+    int values[8] = { 1, 3, 4, 5, 6, 8, 9, 10 };
+    size_t moved = 0;
+
+    int_list_insert_many(&list, values, 8);
+
+    TEST_ASSERT_EQUAL(0, int_list_extend(&copy, &list));
+    TEST_ASSERT_EQUAL(0, int_list_steal_if_count(&list, &odd, NULL, is_odd, &moved));
+    TEST_ASSERT_EQUAL(4, moved);
+    TEST_ASSERT_EQUAL(4, list.size);
+    TEST_ASSERT_EQUAL(1, odd.head->value);
+    TEST_ASSERT_EQUAL(9, odd.tail->value);
+
+    TEST_ASSERT_EQUAL(0, int_list_splice(&list, &odd));
+    TEST_ASSERT_EQUAL(8, list.size);
+    TEST_ASSERT_EQUAL(0, odd.size);
+    TEST_ASSERT_NULL(odd.head);
+
+    TEST_ASSERT_EQUAL(0, int_list_split(&list, list.head->next->next->next->next, &odd));
+    TEST_ASSERT_EQUAL(4, list.size);
+    TEST_ASSERT_EQUAL(4, odd.size);
+    TEST_ASSERT_EQUAL(10, list.tail->value);
+    TEST_ASSERT_EQUAL(1, odd.head->value);
+
+    TEST_ASSERT_EQUAL(0, int_list_steal(&copy, &odd, 0));
+    TEST_ASSERT_EQUAL(7, copy.size);
+    TEST_ASSERT_EQUAL(1, odd.tail->value);
+
+    int_list_destroy(&list);
+    int_list_destroy(&odd);
+    int_list_destroy(&copy);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_typed_list_WHEN_insert_and_remove_THEN_values_are_stored_inline);
+    RUN_TEST(test_GIVEN_typed_list_WHEN_sort_THEN_values_are_sorted_and_stable);
+    RUN_TEST(test_GIVEN_typed_lists_WHEN_steal_if_splice_and_split_THEN_nodes_are_moved);
+
+    return UNITY_END();
+}
+
+int compare_int(const int *a, const int *b) {
+    return (*a > *b) - (*a < *b);
+}
+
+int compare_point_x(const point_t *a, const point_t *b) {
+    return (a->x > b->x) - (a->x < b->x);
+}
+
+bool is_odd(int* value, void* x) {
+    return *value % 2 != 0;
+}
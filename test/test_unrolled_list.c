@@ -0,0 +1,264 @@
+/*
+MIT License
+
+Copyright (c) 2022 Christopher Irvine
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdlib.h>
+
+#include <unity.h>
+
+#include <scds/unrolled_list.h>
+
+static int compare_int_descending(const void *a, const void *b);
+static int compare_int_in_direction(const void *a, const void *b, void *direction);
+static bool is_odd(void* value, void* x);
+static size_t count_blocks(unrolled_list_t* list);
+
+void setUp(void) { }
+void tearDown(void) { }
+
+void test_GIVEN_unrolled_list_WHEN_new_THEN_memory_is_allocated_and_unrolled_list_is_initialised() {
+    unrolled_list_t* list = unrolled_list_new();
+
+    TEST_ASSERT_NOT_NULL(list);
+    TEST_ASSERT_EQUAL(0, list->size);
+    TEST_ASSERT_NULL(list->head);
+    TEST_ASSERT_NULL(list->tail);
+
+    unrolled_list_free(list);
+}
+
+void test_GIVEN_unrolled_list_WHEN_insert_multiple_THEN_blocks_are_filled_in_order() {
+    unrolled_list_t list;
+    unrolled_list_init(&list);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) i;
+        unrolled_list_insert(&list, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL(100, list.size);
+    TEST_ASSERT_EQUAL(4, count_blocks(&list));
+    TEST_ASSERT_EQUAL(UNROLLED_BLOCK_SLOTS, list.head->count);
+    TEST_ASSERT_EQUAL(0, (size_t) list.head % UNROLLED_BLOCK_ALIGNMENT);
+    TEST_ASSERT_EQUAL_PTR(&values[0], list.head->slots[0]);
+    TEST_ASSERT_EQUAL_PTR(&values[99], list.tail->slots[list.tail->count - 1]);
+
+    unrolled_list_destroy(&list);
+}
+
+void test_GIVEN_unrolled_list_WHEN_remove_THEN_data_is_removed() {
+    unrolled_list_t list;
+    unrolled_list_init(&list);
+
+    int values[60];
+
+    for (size_t i = 0; i < 60; i++) {
+        values[i] = (int) i;
+        unrolled_list_insert(&list, &values[i]);
+    }
+
+    for (size_t i = 0; i < 60; i += 2) {
+        TEST_ASSERT_EQUAL(0, unrolled_list_remove(&list, &values[i]));
+    }
+
+    TEST_ASSERT_EQUAL(-1, unrolled_list_remove(&list, &values[0]));
+    TEST_ASSERT_EQUAL(30, list.size);
+    TEST_ASSERT_FALSE(unrolled_list_contains(&list, &values[58]));
+    TEST_ASSERT_TRUE(unrolled_list_contains(&list, &values[59]));
+
+    size_t expected = 1;
+
+    for (unrolled_block_t* block = list.head; block != NULL; block = block->next) {
+        for (size_t slot = 0; slot < block->count; slot++) {
+            TEST_ASSERT_EQUAL(expected, *(int*)block->slots[slot]);
+            expected += 2;
+        }
+    }
+
+    unrolled_list_destroy(&list);
+}
+
+void test_GIVEN_unrolled_list_WHEN_remove_if_THEN_blocks_are_packed() {
+    unrolled_list_t list;
+    unrolled_list_init(&list);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) i;
+        unrolled_list_insert(&list, &values[i]);
+    }
+
+    unrolled_list_remove_if(&list, NULL, is_odd);
+
+    TEST_ASSERT_EQUAL(50, list.size);
+    TEST_ASSERT_EQUAL(2, count_blocks(&list));
+    TEST_ASSERT_EQUAL_PTR(&values[0], list.head->slots[0]);
+    TEST_ASSERT_EQUAL_PTR(&values[98], list.tail->slots[list.tail->count - 1]);
+
+    unrolled_list_destroy(&list);
+}
+
+void test_GIVEN_unrolled_list_WHEN_steal_if_THEN_matches_are_moved_in_order() {
+    unrolled_list_t list;
+    unrolled_list_init(&list);
+
+    unrolled_list_t dest;
+    unrolled_list_init(&dest);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) i;
+        unrolled_list_insert(&list, &values[i]);
+    }
+
+    unrolled_list_steal_if(&list, &dest, NULL, is_odd);
+
+    TEST_ASSERT_EQUAL(50, list.size);
+    TEST_ASSERT_EQUAL(50, dest.size);
+    TEST_ASSERT_EQUAL_PTR(&values[1], dest.head->slots[0]);
+    TEST_ASSERT_EQUAL_PTR(&values[99], dest.tail->slots[dest.tail->count - 1]);
+
+    unrolled_list_destroy(&list);
+    unrolled_list_destroy(&dest);
+}
+
+void test_GIVEN_unrolled_list_WHEN_sort_THEN_list_is_sorted() {
+    unrolled_list_t list;
+    unrolled_list_init(&list);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) ((i * 37) % 100);
+        unrolled_list_insert(&list, &values[i]);
+    }
+
+    unrolled_list_sort(&list, compare_int_descending);
+
+    int expected = 99;
+
+    for (unrolled_block_t* block = list.head; block != NULL; block = block->next) {
+        for (size_t slot = 0; slot < block->count; slot++) {
+            TEST_ASSERT_EQUAL(expected--, *(int*)block->slots[slot]);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(-1, expected);
+    TEST_ASSERT_EQUAL(100, list.size);
+
+    unrolled_list_clear(&list);
+
+    TEST_ASSERT_EQUAL(0, list.size);
+    TEST_ASSERT_NULL(list.head);
+    TEST_ASSERT_NULL(list.tail);
+}
+
+void test_GIVEN_unrolled_list_WHEN_sort_r_THEN_list_is_sorted_in_context_direction() {
+    unrolled_list_t list;
+    unrolled_list_init(&list);
+
+    int values[100];
+
+    for (size_t i = 0; i < 100; i++) {
+        values[i] = (int) ((i * 37) % 100);
+        unrolled_list_insert(&list, &values[i]);
+    }
+
+    int direction = 1;
+
+    TEST_ASSERT_EQUAL(0, unrolled_list_sort_r(&list, compare_int_in_direction, &direction));
+
+    int expected = 0;
+
+    for (unrolled_block_t* block = list.head; block != NULL; block = block->next) {
+        for (size_t slot = 0; slot < block->count; slot++) {
+            TEST_ASSERT_EQUAL(expected++, *(int*)block->slots[slot]);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(100, expected);
+
+    unrolled_list_destroy(&list);
+}
+
+int main(int argc, char* argv[]) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_new_THEN_memory_is_allocated_and_unrolled_list_is_initialised);
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_insert_multiple_THEN_blocks_are_filled_in_order);
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_remove_THEN_data_is_removed);
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_remove_if_THEN_blocks_are_packed);
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_steal_if_THEN_matches_are_moved_in_order);
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_sort_THEN_list_is_sorted);
+    RUN_TEST(test_GIVEN_unrolled_list_WHEN_sort_r_THEN_list_is_sorted_in_context_direction);
+
+    return UNITY_END();
+}
+
+bool is_odd(void* value, void* x) {
+    return *(int*)value % 2 != 0;
+}
+
+size_t count_blocks(unrolled_list_t* list) {
+    size_t count = 0;
+
+    for (unrolled_block_t* block = list->head; block != NULL; block = block->next) {
+        count++;
+    }
+
+    return count;
+}
+
+int compare_int_descending(const void *a, const void *b) {
+    int x = *(int*)a;
+    int y = *(int*)b;
+
+    if (x < y) {
+        return 1;
+    }
+
+    if (x > y) {
+        return -1;
+    }
+
+    return 0;
+}
+
+int compare_int_in_direction(const void *a, const void *b, void *direction) {
+    int x = *(int*)a;
+    int y = *(int*)b;
+
+    if (x < y) {
+        return -*(int*)direction;
+    }
+
+    if (x > y) {
+        return *(int*)direction;
+    }
+
+    return 0;
+}